@@ -12,6 +12,9 @@
 #ifndef _LISTE__H
 #define _LISTE__H
 
+#include <iostream>
+#include <stdexcept>
+
 namespace lab03 {
 /**
  * \class Liste
@@ -27,9 +30,13 @@ class Liste
 public:
 	explicit Liste();
 	explicit Liste(const Liste &);
+	Liste(Liste &&) noexcept;
+	template<typename Iterateur> Liste(Iterateur, Iterateur);
 	~Liste();
 
 	const Liste<T> & operator =(const Liste<T> &);
+	const Liste<T> & operator =(Liste<T> &&) noexcept;
+	template<typename Iterateur> void assigner(Iterateur, Iterateur);
 
 	void ajouter(const T &, const int &);
 	void enleverEl(const T &);
@@ -77,13 +84,11 @@ private:
 
 	// Méthodes privées
     
-    // À titre indicatif, voici les méthodes privées de la solution
-    /*
 	elem _pointeurSurNoeud(const int &) const;
 	void _copier(elem);
+	template<typename Iterateur> void _ajouterPlage(Iterateur, Iterateur);
 	void _detruire();
 	void _enlever(elem);
-    */
 };
 
 }
@@ -0,0 +1,445 @@
+#include "ContratException.h"
+
+namespace lab03 {
+
+/**
+ * \brief Affiche la liste, du sommet gauche au sommet droit
+ */
+template<class U>
+std::ostream& operator <<(std::ostream & p_out, const Liste<U> & p_source)
+{
+	p_out << "[";
+	for (typename Liste<U>::elem courant = p_source.m_sommetG; courant != 0;
+			courant = courant->m_suivant)
+	{
+		p_out << courant->m_el;
+		if (courant->m_suivant != 0)
+			p_out << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une liste vide
+ * \post La liste est vide
+ */
+template<typename T>
+Liste<T>::Liste() :
+	m_sommetG(0), m_sommetD(0), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La liste à copier
+ * \post La liste est une copie profonde de p_source
+ */
+template<typename T>
+Liste<T>::Liste(const Liste & p_source) :
+	m_sommetG(0), m_sommetD(0), m_cardinalite(0)
+{
+	_copier(p_source.m_sommetG);
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de déplacement
+ *
+ * La chaîne de noeuds est volée en O(1).
+ *
+ * \param[in] p_source La liste à déplacer
+ * \post p_source est vide
+ */
+template<typename T>
+Liste<T>::Liste(Liste && p_source) noexcept :
+	m_sommetG(p_source.m_sommetG), m_sommetD(p_source.m_sommetD),
+	m_cardinalite(p_source.m_cardinalite)
+{
+	p_source.m_sommetG = 0;
+	p_source.m_sommetD = 0;
+	p_source.m_cardinalite = 0;
+}
+
+/**
+ * \brief Constructeur à partir d'une séquence
+ *
+ * Les noeuds sont chaînés en une seule passe.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \post La liste contient les éléments de la séquence, dans l'ordre
+ */
+template<typename T>
+template<typename Iterateur>
+Liste<T>::Liste(Iterateur p_debut, Iterateur p_fin) :
+	m_sommetG(0), m_sommetD(0), m_cardinalite(0)
+{
+	_ajouterPlage(p_debut, p_fin);
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+Liste<T>::~Liste()
+{
+	_detruire();
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La liste à copier
+ * \return La liste courante, devenue une copie profonde de p_source
+ */
+template<typename T>
+const Liste<T> & Liste<T>::operator =(const Liste<T> & p_source)
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		_copier(p_source.m_sommetG);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Opérateur d'assignation par déplacement
+ * \param[in] p_source La liste à déplacer
+ * \return La liste courante, qui possède maintenant les noeuds de p_source
+ * \post p_source est vide
+ */
+template<typename T>
+const Liste<T> & Liste<T>::operator =(Liste<T> && p_source) noexcept
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		m_sommetG = p_source.m_sommetG;
+		m_sommetD = p_source.m_sommetD;
+		m_cardinalite = p_source.m_cardinalite;
+		p_source.m_sommetG = 0;
+		p_source.m_sommetD = 0;
+		p_source.m_cardinalite = 0;
+	}
+	return *this;
+}
+
+/**
+ * \brief Remplace le contenu de la liste par une séquence
+ *
+ * Les noeuds existants sont réutilisés; seuls les noeuds manquants sont
+ * alloués et seuls les noeuds en trop sont libérés.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \post La liste contient les éléments de la séquence, dans l'ordre
+ */
+template<typename T>
+template<typename Iterateur>
+void Liste<T>::assigner(Iterateur p_debut, Iterateur p_fin)
+{
+	elem courant = m_sommetG;
+	while (courant != 0 && p_debut != p_fin)
+	{
+		courant->m_el = *p_debut;
+		courant = courant->m_suivant;
+		++p_debut;
+	}
+
+	while (courant != 0)
+	{
+		elem suivant = courant->m_suivant;
+		_enlever(courant);
+		courant = suivant;
+	}
+	_ajouterPlage(p_debut, p_fin);
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute un élément à une position donnée
+ *
+ * \param[in] p_el L'élément à ajouter
+ * \param[in] p_pos La position de l'ajout, de 1 à taille() + 1
+ * \pre La position est valide
+ * \post L'élément occupe la position p_pos
+ */
+template<typename T>
+void Liste<T>::ajouter(const T & p_el, const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite + 1);
+
+	if (p_pos == m_cardinalite + 1)
+	{
+		elem nouveau = new Noeud(p_el, 0, m_sommetD);
+		if (m_sommetD != 0)
+		{
+			m_sommetD->m_suivant = nouveau;
+		}
+		else
+		{
+			m_sommetG = nouveau;
+		}
+		m_sommetD = nouveau;
+	}
+	else
+	{
+		elem cible = _pointeurSurNoeud(p_pos);
+		elem nouveau = new Noeud(p_el, cible, cible->m_precedent);
+		if (cible->m_precedent != 0)
+		{
+			cible->m_precedent->m_suivant = nouveau;
+		}
+		else
+		{
+			m_sommetG = nouveau;
+		}
+		cible->m_precedent = nouveau;
+	}
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Enlève la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément à enlever
+ * \pre L'élément appartient à la liste
+ * \post La liste compte un élément de moins
+ */
+template<typename T>
+void Liste<T>::enleverEl(const T & p_el)
+{
+	for (elem courant = m_sommetG; courant != 0; courant = courant->m_suivant)
+	{
+		if (courant->m_el == p_el)
+		{
+			_enlever(courant);
+			INVARIANTS();
+			return;
+		}
+	}
+	throw std::logic_error("enleverEl: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Enlève l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ * \post La liste compte un élément de moins
+ */
+template<typename T>
+void Liste<T>::enleverPos(const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite);
+
+	_enlever(_pointeurSurNoeud(p_pos));
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int Liste<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Vérifie si la liste est vide
+ */
+template<typename T>
+bool Liste<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Vérifie si un élément est dans la liste
+ * \param[in] p_el L'élément recherché
+ */
+template<typename T>
+bool Liste<T>::appartient(const T & p_el) const
+{
+	for (elem courant = m_sommetG; courant != 0; courant = courant->m_suivant)
+	{
+		if (courant->m_el == p_el)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief Retourne l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ */
+template<typename T>
+T Liste<T>::element(const int & p_pos) const
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite);
+
+	return _pointeurSurNoeud(p_pos)->m_el;
+}
+
+/**
+ * \brief Retourne la position de la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément recherché
+ * \pre L'élément appartient à la liste
+ */
+template<typename T>
+int Liste<T>::position(const T & p_el) const
+{
+	int pos = 1;
+	for (elem courant = m_sommetG; courant != 0; courant = courant->m_suivant)
+	{
+		if (courant->m_el == p_el)
+		{
+			return pos;
+		}
+		++pos;
+	}
+	throw std::logic_error("position: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et les sommets
+ */
+template<typename T>
+void Liste<T>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT((m_cardinalite == 0) == (m_sommetG == 0));
+	INVARIANT((m_sommetG == 0) == (m_sommetD == 0));
+	INVARIANT(m_sommetG == 0 || m_sommetG->m_precedent == 0);
+	INVARIANT(m_sommetD == 0 || m_sommetD->m_suivant == 0);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne le noeud à une position donnée
+ *
+ * Le parcours part du sommet le plus proche de la position.
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ */
+template<typename T>
+typename Liste<T>::elem Liste<T>::_pointeurSurNoeud(const int & p_pos) const
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite);
+
+	elem courant;
+	if (p_pos <= m_cardinalite / 2)
+	{
+		courant = m_sommetG;
+		for (int i = 1; i < p_pos; ++i)
+		{
+			courant = courant->m_suivant;
+		}
+	}
+	else
+	{
+		courant = m_sommetD;
+		for (int i = m_cardinalite; i > p_pos; --i)
+		{
+			courant = courant->m_precedent;
+		}
+	}
+	return courant;
+}
+
+/**
+ * \brief Ajoute à la fin une copie de chaque élément d'une chaîne
+ *
+ * \param[in] p_premier Le premier noeud de la chaîne à copier, 0 si elle est vide
+ * \pre La liste courante est vide
+ */
+template<typename T>
+void Liste<T>::_copier(elem p_premier)
+{
+	for (elem source = p_premier; source != 0; source = source->m_suivant)
+	{
+		ajouter(source->m_el, m_cardinalite + 1);
+	}
+}
+
+/**
+ * \brief Ajoute à la fin les éléments d'une séquence, en une seule passe
+ *
+ * L'ajout en queue passe par m_sommetD, sans parcours.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ */
+template<typename T>
+template<typename Iterateur>
+void Liste<T>::_ajouterPlage(Iterateur p_debut, Iterateur p_fin)
+{
+	for (; p_debut != p_fin; ++p_debut)
+	{
+		ajouter(*p_debut, m_cardinalite + 1);
+	}
+}
+
+/**
+ * \brief Libère tous les noeuds
+ * \post La liste est vide
+ */
+template<typename T>
+void Liste<T>::_detruire()
+{
+	while (m_sommetG != 0)
+	{
+		elem suivant = m_sommetG->m_suivant;
+		delete m_sommetG;
+		m_sommetG = suivant;
+	}
+	m_sommetD = 0;
+	m_cardinalite = 0;
+}
+
+/**
+ * \brief Détache et libère un noeud
+ *
+ * \param[in] p_cible Le noeud à enlever
+ */
+template<typename T>
+void Liste<T>::_enlever(elem p_cible)
+{
+	if (p_cible->m_precedent != 0)
+	{
+		p_cible->m_precedent->m_suivant = p_cible->m_suivant;
+	}
+	else
+	{
+		m_sommetG = p_cible->m_suivant;
+	}
+
+	if (p_cible->m_suivant != 0)
+	{
+		p_cible->m_suivant->m_precedent = p_cible->m_precedent;
+	}
+	else
+	{
+		m_sommetD = p_cible->m_precedent;
+	}
+
+	delete p_cible;
+	--m_cardinalite;
+}
+
+} //Fin du namespace
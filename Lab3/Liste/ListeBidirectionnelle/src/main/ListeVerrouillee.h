@@ -0,0 +1,103 @@
+/**
+ * \file ListeVerrouillee.h
+ * \brief Classe définissant une Liste partagée entre plusieurs fils.
+ * \version 0.1
+ *
+ * Implémentation dans une liste doublement chaînée avec un verrou par
+ * noeud. Les parcours se font de gauche à droite en verrouillage couplé
+ * (le noeud suivant est verrouillé avant de relâcher le précédent), ce qui
+ * laisse des fils travailler en même temps sur des régions distinctes.
+ */
+
+#ifndef _LISTEVERROUILLEE__H
+#define _LISTEVERROUILLEE__H
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+
+namespace lab03 {
+/**
+ * \class ListeVerrouillee
+ *
+ * \brief classe générique représentant une liste ordonnée concurrente
+ *
+ *  Même interface que Liste, mais ajouter, enleverEl, enleverPos,
+ *  appartient, element et position peuvent être appelés en même temps
+ *  par plusieurs fils. Les positions sont évaluées au moment où le
+ *  parcours les atteint.
+ */
+template<typename T>
+class ListeVerrouillee
+{
+public:
+	ListeVerrouillee();
+	~ListeVerrouillee();
+
+	void ajouter(const T &, const int &);
+	void enleverEl(const T &);
+	void enleverPos(const int &);
+
+	int taille() const;
+	bool estVide() const;
+	bool appartient(const T &) const;
+	T element(const int &) const;
+	int position(const T &) const;
+
+	void verifieInvariant() const;
+
+	template<class U> friend std::ostream& operator <<(std::ostream &,
+			const ListeVerrouillee<U> &);
+private:
+	ListeVerrouillee(const ListeVerrouillee &);
+	const ListeVerrouillee<T> & operator =(const ListeVerrouillee<T> &);
+
+	/**
+	 * \class Maillon
+	 *
+	 * \brief Chaînage et verrou d'une position; les sentinelles n'ont que cette partie.
+	 */
+	class Maillon {
+	public:
+		Maillon * m_suivant; /*!<Un pointeur vers le maillon suivant*/
+		Maillon * m_precedent; /*!<Un pointeur vers le maillon précédent*/
+		std::mutex m_verrou; /*!<Protège m_suivant, m_precedent et l'élément*/
+
+		explicit Maillon(Maillon * next_ptr = 0, Maillon * prev_ptr = 0) :
+				m_suivant(next_ptr), m_precedent(prev_ptr) {
+		}
+	};
+
+	/**
+	 * \class Noeud
+	 *
+	 * \brief Classe interne représentant un noeud (une position) dans la liste.
+	 */
+	class Noeud: public Maillon {
+	public:
+		T m_el; /*!<L'élément de base de la liste*/
+
+		explicit Noeud(const T& data_item, Maillon * next_ptr = 0,
+				Maillon * prev_ptr = 0) :
+				Maillon(next_ptr, prev_ptr), m_el(data_item) {
+		}
+	};
+
+	typedef Maillon * elem;
+	typedef std::unique_lock<std::mutex> verrou;
+
+	mutable Maillon m_sentinelleG; /*!<Sentinelle avant le premier noeud*/
+	mutable Maillon m_sentinelleD; /*!<Sentinelle après le dernier noeud*/
+	std::atomic<int> m_cardinalite; /*!< Cardinalité de la liste*/
+
+	// Méthodes privées
+	void _avancer(elem &, verrou &, elem &, verrou &) const;
+	void _detacher(elem, verrou &, elem, verrou &);
+	static const T & _element(elem);
+};
+} //Fin du namespace
+
+#include "ListeVerrouillee.hpp"
+
+#endif
@@ -0,0 +1,316 @@
+#include "ContratException.h"
+
+namespace lab03 {
+
+/**
+ * \brief Affiche la liste, de gauche à droite
+ */
+template<class U>
+std::ostream& operator <<(std::ostream & p_out, const ListeVerrouillee<U> & p_source)
+{
+	typedef typename ListeVerrouillee<U>::elem elem;
+	typedef typename ListeVerrouillee<U>::verrou verrou;
+
+	p_out << "[";
+	elem precedent = &p_source.m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	while (courant != &p_source.m_sentinelleD)
+	{
+		if (precedent != &p_source.m_sentinelleG)
+			p_out << ",";
+		p_out << ListeVerrouillee<U>::_element(courant);
+		p_source._avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une liste vide
+ * \post La liste est vide
+ */
+template<typename T>
+ListeVerrouillee<T>::ListeVerrouillee() :
+	m_sentinelleG(&m_sentinelleD, 0), m_sentinelleD(0, &m_sentinelleG), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ * \pre Aucun autre fil n'utilise la liste
+ */
+template<typename T>
+ListeVerrouillee<T>::~ListeVerrouillee()
+{
+	elem courant = m_sentinelleG.m_suivant;
+	while (courant != &m_sentinelleD)
+	{
+		elem suivant = courant->m_suivant;
+		delete static_cast<Noeud *>(courant);
+		courant = suivant;
+	}
+}
+
+/**
+ * \brief Ajoute un élément à une position donnée
+ *
+ * Seuls les deux noeuds qui encadrent la position sont verrouillés pendant
+ * le chaînage. Si la liste a raccourci entre-temps, l'élément est ajouté à
+ * la fin.
+ *
+ * \param[in] p_el L'élément à ajouter
+ * \param[in] p_pos La position de l'ajout, de 1 à taille() + 1
+ * \pre La position est valide
+ */
+template<typename T>
+void ListeVerrouillee<T>::ajouter(const T & p_el, const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= taille() + 1);
+
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	for (int i = 1; i < p_pos && courant != &m_sentinelleD; ++i)
+	{
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+
+	elem nouveau = new Noeud(p_el, courant, precedent);
+	precedent->m_suivant = nouveau;
+	courant->m_precedent = nouveau;
+	m_cardinalite.fetch_add(1);
+}
+
+/**
+ * \brief Enlève la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément à enlever
+ * \pre L'élément appartient à la liste
+ */
+template<typename T>
+void ListeVerrouillee<T>::enleverEl(const T & p_el)
+{
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	while (courant != &m_sentinelleD)
+	{
+		if (_element(courant) == p_el)
+		{
+			_detacher(precedent, verrouPrecedent, courant, verrouCourant);
+			return;
+		}
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	throw std::logic_error("enleverEl: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Enlève l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ */
+template<typename T>
+void ListeVerrouillee<T>::enleverPos(const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= taille());
+
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	for (int i = 1; i < p_pos && courant != &m_sentinelleD; ++i)
+	{
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	if (courant == &m_sentinelleD)
+	{
+		throw std::logic_error("enleverPos: la liste a raccourci sous cette position");
+	}
+	_detacher(precedent, verrouPrecedent, courant, verrouCourant);
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Sous accès concurrent, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int ListeVerrouillee<T>::taille() const
+{
+	return m_cardinalite.load();
+}
+
+/**
+ * \brief Vérifie si la liste est vide
+ */
+template<typename T>
+bool ListeVerrouillee<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Vérifie si un élément est dans la liste
+ * \param[in] p_el L'élément recherché
+ */
+template<typename T>
+bool ListeVerrouillee<T>::appartient(const T & p_el) const
+{
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	while (courant != &m_sentinelleD)
+	{
+		if (_element(courant) == p_el)
+		{
+			return true;
+		}
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	return false;
+}
+
+/**
+ * \brief Retourne l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ */
+template<typename T>
+T ListeVerrouillee<T>::element(const int & p_pos) const
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= taille());
+
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	for (int i = 1; i < p_pos && courant != &m_sentinelleD; ++i)
+	{
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	if (courant == &m_sentinelleD)
+	{
+		throw std::logic_error("element: la liste a raccourci sous cette position");
+	}
+	return _element(courant);
+}
+
+/**
+ * \brief Retourne la position de la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément recherché
+ * \pre L'élément appartient à la liste
+ */
+template<typename T>
+int ListeVerrouillee<T>::position(const T & p_el) const
+{
+	elem precedent = &m_sentinelleG;
+	verrou verrouPrecedent(precedent->m_verrou);
+	elem courant = precedent->m_suivant;
+	verrou verrouCourant(courant->m_verrou);
+	for (int pos = 1; courant != &m_sentinelleD; ++pos)
+	{
+		if (_element(courant) == p_el)
+		{
+			return pos;
+		}
+		_avancer(precedent, verrouPrecedent, courant, verrouCourant);
+	}
+	throw std::logic_error("position: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Vérifie le double chaînage et la cardinalité
+ *
+ * Les opérations ne l'appellent pas: l'invariant n'est observable que
+ * lorsqu'aucun autre fil ne modifie la liste.
+ */
+template<typename T>
+void ListeVerrouillee<T>::verifieInvariant() const
+{
+	INVARIANT(m_sentinelleG.m_precedent == 0);
+	INVARIANT(m_sentinelleD.m_suivant == 0);
+	int cardinalite = 0;
+	for (elem courant = m_sentinelleG.m_suivant; courant != &m_sentinelleD;
+			courant = courant->m_suivant)
+	{
+		INVARIANT(courant->m_precedent->m_suivant == courant);
+		++cardinalite;
+	}
+	INVARIANT(m_sentinelleD.m_precedent->m_suivant == &m_sentinelleD);
+	INVARIANT(cardinalite == m_cardinalite.load());
+}
+
+// Méthodes privées
+
+/**
+ * \brief Avance d'une position en verrouillage couplé
+ *
+ * Le maillon suivant est verrouillé avant que le précédent soit relâché.
+ *
+ * \param[in,out] p_precedent Le maillon précédent, verrouillé par p_verrouPrecedent
+ * \param[in,out] p_verrouPrecedent Le verrou détenu sur p_precedent
+ * \param[in,out] p_courant Le maillon courant, verrouillé par p_verrouCourant
+ * \param[in,out] p_verrouCourant Le verrou détenu sur p_courant
+ * \pre p_courant n'est pas la sentinelle droite
+ */
+template<typename T>
+void ListeVerrouillee<T>::_avancer(elem & p_precedent, verrou & p_verrouPrecedent,
+		elem & p_courant, verrou & p_verrouCourant) const
+{
+	elem suivant = p_courant->m_suivant;
+	verrou verrouSuivant(suivant->m_verrou);
+	p_verrouPrecedent = std::move(p_verrouCourant);
+	p_verrouCourant = std::move(verrouSuivant);
+	p_precedent = p_courant;
+	p_courant = suivant;
+}
+
+/**
+ * \brief Détache et libère un noeud
+ *
+ * Le successeur est verrouillé à son tour (toujours de gauche à droite)
+ * pour mettre à jour son m_precedent.
+ *
+ * \param[in] p_precedent Le maillon précédent, verrouillé
+ * \param[in] p_verrouPrecedent Le verrou détenu sur p_precedent
+ * \param[in] p_cible Le noeud à enlever, verrouillé
+ * \param[in] p_verrouCible Le verrou détenu sur p_cible
+ */
+template<typename T>
+void ListeVerrouillee<T>::_detacher(elem p_precedent, verrou & p_verrouPrecedent,
+		elem p_cible, verrou & p_verrouCible)
+{
+	elem suivant = p_cible->m_suivant;
+	{
+		verrou verrouSuivant(suivant->m_verrou);
+		p_precedent->m_suivant = suivant;
+		suivant->m_precedent = p_precedent;
+	}
+	m_cardinalite.fetch_sub(1);
+
+	// Plus aucun fil ne peut atteindre la cible: il faudrait passer par le précédent.
+	p_verrouCible.unlock();
+	p_verrouPrecedent.unlock();
+	delete static_cast<Noeud *>(p_cible);
+}
+
+/**
+ * \brief Accède à l'élément d'un maillon qui n'est pas une sentinelle
+ */
+template<typename T>
+const T & ListeVerrouillee<T>::_element(elem p_maillon)
+{
+	return static_cast<const Noeud *>(p_maillon)->m_el;
+}
+
+} //Fin du namespace
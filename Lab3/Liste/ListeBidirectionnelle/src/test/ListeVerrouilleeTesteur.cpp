@@ -0,0 +1,114 @@
+/**
+ * \file ListeVerrouilleeTesteur.cpp
+ * \brief Les tests unitaires de ListeVerrouillee.
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour ListeVerrouillee
+ */
+
+#include "gtest/gtest.h"
+#include "../main/ListeVerrouillee.h"
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace lab03;
+
+static const int NB_FILS = 8;
+static const int NB_PAR_FIL = 500;
+
+class ListeVerrouilleeTest: public ::testing::Test
+{
+protected:
+	virtual void SetUp() {
+		liste.ajouter(10, 1);
+		liste.ajouter(20, 2);
+		liste.ajouter(30, 3);
+	}
+	ListeVerrouillee<int> listeVide;
+	ListeVerrouillee<int> liste;
+};
+
+TEST_F(ListeVerrouilleeTest, constructeurVideOK)
+{
+	EXPECT_EQ(0, listeVide.taille());
+	EXPECT_TRUE(listeVide.estVide());
+	listeVide.verifieInvariant();
+}
+
+TEST_F(ListeVerrouilleeTest, ajouterOK)
+{
+	liste.ajouter(15, 2);
+	liste.ajouter(5, 1);
+	std::ostringstream oss;
+	oss << liste;
+	EXPECT_EQ("[5,10,15,20,30]", oss.str());
+	EXPECT_EQ(3, liste.position(15));
+	EXPECT_EQ(30, liste.element(5));
+
+	EXPECT_THROW(liste.ajouter(40, 0), PreconditionException);
+	EXPECT_THROW(liste.ajouter(40, 7), PreconditionException);
+	liste.verifieInvariant();
+}
+
+TEST_F(ListeVerrouilleeTest, enleverOK)
+{
+	liste.enleverEl(20);
+	EXPECT_FALSE(liste.appartient(20));
+	EXPECT_EQ(2, liste.position(30));
+	liste.enleverPos(1);
+	EXPECT_EQ(30, liste.element(1));
+	EXPECT_EQ(1, liste.taille());
+
+	EXPECT_THROW(liste.enleverEl(20), std::logic_error);
+	EXPECT_THROW(liste.enleverPos(2), PreconditionException);
+	EXPECT_THROW(liste.position(20), std::logic_error);
+	liste.verifieInvariant();
+}
+
+TEST_F(ListeVerrouilleeTest, ajoutsConcurrentsRegionsDistinctes)
+{
+	for (int i = 0; i < NB_FILS * 10; ++i)
+		listeVide.ajouter(-1, 1);
+
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+				listeVide.ajouter(f * NB_PAR_FIL + i, f * 10 + 1);
+		}));
+	}
+	for (std::thread & fil : fils)
+		fil.join();
+
+	EXPECT_EQ(NB_FILS * (10 + NB_PAR_FIL), listeVide.taille());
+	for (int v = 0; v < NB_FILS * NB_PAR_FIL; v += 37)
+		EXPECT_TRUE(listeVide.appartient(v));
+	listeVide.verifieInvariant();
+}
+
+TEST_F(ListeVerrouilleeTest, ajoutsEtRetraitsConcurrents)
+{
+	for (int v = 0; v < NB_FILS * NB_PAR_FIL; ++v)
+		listeVide.ajouter(v, listeVide.taille() + 1);
+
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+			{
+				listeVide.enleverEl(f * NB_PAR_FIL + i);
+				listeVide.ajouter(-(f + 1), 1);
+			}
+		}));
+	}
+	for (std::thread & fil : fils)
+		fil.join();
+
+	EXPECT_EQ(NB_FILS * NB_PAR_FIL, listeVide.taille());
+	EXPECT_FALSE(listeVide.appartient(0));
+	EXPECT_TRUE(listeVide.appartient(-NB_FILS));
+	listeVide.verifieInvariant();
+}
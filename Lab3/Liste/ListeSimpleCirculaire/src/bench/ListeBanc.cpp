@@ -0,0 +1,204 @@
+/**
+ * \file ListeBanc.cpp
+ * \brief Bancs d'essai de Liste comparée aux conteneurs de la STL.
+ * \version 0.1
+ *
+ * Mesure l'ajout et le retrait en tête, au milieu et en queue, la
+ * recherche, la copie et le parcours pour Liste, std::list, std::deque et
+ * std::vector. Les défauts de cache sont publiés lorsque les compteurs
+ * perf sont accessibles.
+ */
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <vector>
+#include "CompteurCache.h"
+#include "../main/Liste.h"
+
+using namespace lab03;
+
+namespace
+{
+enum Endroit { TETE, MILIEU, QUEUE };
+
+/**
+ * \class Operations
+ *
+ * \brief Adapte l'interface de chaque conteneur aux opérations mesurées.
+ */
+template<typename C>
+struct Operations
+{
+	static typename C::iterator position(C & p_c, Endroit p_endroit, bool p_ajout)
+	{
+		if (p_endroit == QUEUE)
+			return p_ajout ? p_c.end() : std::prev(p_c.end());
+
+		typename C::iterator it = p_c.begin();
+		if (p_endroit == MILIEU)
+			std::advance(it, p_ajout ? p_c.size() / 2 : (p_c.size() - 1) / 2);
+		return it;
+	}
+	static void ajouter(C & p_c, int p_el, Endroit p_endroit) { p_c.insert(position(p_c, p_endroit, true), p_el); }
+	static void enlever(C & p_c, Endroit p_endroit) { p_c.erase(position(p_c, p_endroit, false)); }
+	static bool chercher(const C & p_c, int p_el) { return std::find(p_c.begin(), p_c.end(), p_el) != p_c.end(); }
+	static long parcourir(const C & p_c)
+	{
+		long somme = 0;
+		for (int el : p_c)
+			somme += el;
+		return somme;
+	}
+};
+
+template<>
+struct Operations<Liste<int> >
+{
+	static int position(const Liste<int> & p_c, Endroit p_endroit, bool p_ajout)
+	{
+		int n = p_c.taille();
+		if (p_endroit == TETE)
+			return 1;
+		if (p_endroit == MILIEU)
+			return p_ajout ? n / 2 + 1 : (n + 1) / 2;
+		return p_ajout ? n + 1 : n;
+	}
+	static void ajouter(Liste<int> & p_c, int p_el, Endroit p_endroit) { p_c.ajouter(p_el, position(p_c, p_endroit, true)); }
+	static void enlever(Liste<int> & p_c, Endroit p_endroit) { p_c.enleverPos(position(p_c, p_endroit, false)); }
+	static bool chercher(const Liste<int> & p_c, int p_el) { return p_c.appartient(p_el); }
+	static long parcourir(const Liste<int> & p_c)
+	{
+		long somme = 0;
+		for (int i = 1; i <= p_c.taille(); ++i)
+			somme += p_c.element(i);
+		return somme;
+	}
+};
+
+template<typename C>
+void remplir(C & p_c, int p_n)
+{
+	for (int i = 0; i < p_n; ++i)
+		Operations<C>::ajouter(p_c, i, QUEUE);
+}
+
+template<typename C, Endroit E>
+void BM_ajouter(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C c;
+		for (int i = 0; i < n; ++i)
+			Operations<C>::ajouter(c, i, E);
+		benchmark::DoNotOptimize(&c);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C, Endroit E>
+void BM_enlever(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		p_etat.PauseTiming();
+		C c;
+		remplir(c, n);
+		p_etat.ResumeTiming();
+		for (int i = 0; i < n; ++i)
+			Operations<C>::enlever(c, E);
+		benchmark::DoNotOptimize(&c);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_chercher(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		// Le dernier élément et un élément absent: deux parcours complets.
+		benchmark::DoNotOptimize(Operations<C>::chercher(source, n - 1));
+		benchmark::DoNotOptimize(Operations<C>::chercher(source, n));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+template<typename C>
+void BM_copie(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C copie(source);
+		benchmark::DoNotOptimize(&copie);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_parcours(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(Operations<C>::parcourir(source));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+/**
+ * \brief Parcours de Liste par le tourniquet, en O(1) par élément
+ */
+void BM_parcoursTourniquet(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	Liste<int> source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		long somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += source.prochain();
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+} // namespace
+
+#define BANC_LISTE(conteneur) \
+	BENCHMARK_TEMPLATE(BM_ajouter, conteneur, TETE)->RangeMultiplier(8)->Range(8, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_ajouter, conteneur, MILIEU)->RangeMultiplier(8)->Range(8, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_ajouter, conteneur, QUEUE)->RangeMultiplier(8)->Range(8, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_enlever, conteneur, TETE)->RangeMultiplier(8)->Range(64, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_enlever, conteneur, MILIEU)->RangeMultiplier(8)->Range(64, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_enlever, conteneur, QUEUE)->RangeMultiplier(8)->Range(64, 1 << 12); \
+	BENCHMARK_TEMPLATE(BM_chercher, conteneur)->RangeMultiplier(8)->Range(8, 1 << 15); \
+	BENCHMARK_TEMPLATE(BM_copie, conteneur)->RangeMultiplier(8)->Range(8, 1 << 15); \
+	BENCHMARK_TEMPLATE(BM_parcours, conteneur)->RangeMultiplier(8)->Range(8, 1 << 12)
+
+BANC_LISTE(Liste<int>);
+BANC_LISTE(std::list<int>);
+BANC_LISTE(std::deque<int>);
+BANC_LISTE(std::vector<int>);
+
+BENCHMARK(BM_parcoursTourniquet)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,562 @@
+#include "ContratException.h"
+
+namespace lab03 {
+
+/**
+ * \brief Affiche la liste, de la première à la dernière position
+ */
+template<class U>
+std::ostream& operator <<(std::ostream & p_out, const Liste<U> & p_source)
+{
+	p_out << "[";
+	if (p_source.m_dernier != 0)
+	{
+		typename Liste<U>::elem courant = p_source.m_dernier->m_suivant;
+		while (courant != p_source.m_dernier)
+		{
+			p_out << courant->m_el << ",";
+			courant = courant->m_suivant;
+		}
+		p_out << courant->m_el;
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une liste vide
+ * \post La liste est vide
+ */
+template<typename T>
+Liste<T>::Liste() :
+	m_dernier(0), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La liste à copier
+ * \post La liste est une copie profonde de p_source
+ */
+template<typename T>
+Liste<T>::Liste(const Liste & p_source) :
+	m_dernier(0), m_cardinalite(0)
+{
+	_copier(p_source.m_dernier);
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de déplacement
+ *
+ * La chaîne de noeuds est volée en O(1).
+ *
+ * \param[in] p_source La liste à déplacer
+ * \post p_source est vide
+ */
+template<typename T>
+Liste<T>::Liste(Liste && p_source) noexcept :
+	m_dernier(p_source.m_dernier), m_cardinalite(p_source.m_cardinalite)
+{
+	p_source.m_dernier = 0;
+	p_source.m_cardinalite = 0;
+}
+
+/**
+ * \brief Constructeur à partir d'une séquence
+ *
+ * Les noeuds sont chaînés en une seule passe.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \post La liste contient les éléments de la séquence, dans l'ordre
+ */
+template<typename T>
+template<typename Iterateur>
+Liste<T>::Liste(Iterateur p_debut, Iterateur p_fin) :
+	m_dernier(0), m_cardinalite(0)
+{
+	_ajouterPlage(p_debut, p_fin);
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+Liste<T>::~Liste()
+{
+	_detruire();
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La liste à copier
+ * \return La liste courante, devenue une copie profonde de p_source
+ */
+template<typename T>
+const Liste<T> & Liste<T>::operator =(const Liste<T> & p_source)
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		_copier(p_source.m_dernier);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Opérateur d'assignation par déplacement
+ * \param[in] p_source La liste à déplacer
+ * \return La liste courante, qui possède maintenant les noeuds de p_source
+ * \post p_source est vide
+ */
+template<typename T>
+const Liste<T> & Liste<T>::operator =(Liste<T> && p_source) noexcept
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		m_dernier = p_source.m_dernier;
+		m_cardinalite = p_source.m_cardinalite;
+		p_source.m_dernier = 0;
+		p_source.m_cardinalite = 0;
+	}
+	return *this;
+}
+
+/**
+ * \brief Remplace le contenu de la liste par une séquence
+ *
+ * Les noeuds existants sont réutilisés; seuls les noeuds manquants sont
+ * alloués et seuls les noeuds en trop sont libérés.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \post La liste contient les éléments de la séquence, dans l'ordre
+ */
+template<typename T>
+template<typename Iterateur>
+void Liste<T>::assigner(Iterateur p_debut, Iterateur p_fin)
+{
+	elem precedent = m_dernier;
+	int reutilises = 0;
+	while (reutilises < m_cardinalite && p_debut != p_fin)
+	{
+		precedent = precedent->m_suivant;
+		precedent->m_el = *p_debut;
+		++p_debut;
+		++reutilises;
+	}
+
+	if (reutilises == 0)
+	{
+		_detruire();
+	}
+	else if (reutilises < m_cardinalite)
+	{
+		elem premier = m_dernier->m_suivant;
+		elem courant = precedent->m_suivant;
+		while (courant != premier)
+		{
+			elem suivant = courant->m_suivant;
+			delete courant;
+			courant = suivant;
+		}
+		precedent->m_suivant = premier;
+		m_dernier = precedent;
+		m_cardinalite = reutilises;
+	}
+	_ajouterPlage(p_debut, p_fin);
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute un élément à une position donnée
+ *
+ * \param[in] p_el L'élément à ajouter
+ * \param[in] p_pos La position de l'ajout, de 1 à taille() + 1
+ * \pre La position est valide
+ * \post L'élément occupe la position p_pos
+ */
+template<typename T>
+void Liste<T>::ajouter(const T & p_el, const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite + 1);
+
+	if (m_dernier == 0)
+	{
+		m_dernier = new Noeud(p_el);
+		m_dernier->m_suivant = m_dernier;
+	}
+	else
+	{
+		elem precedent = _pointeurSurNoeud(p_pos - 1);
+		precedent->m_suivant = new Noeud(p_el, precedent->m_suivant);
+		if (p_pos == m_cardinalite + 1)
+		{
+			m_dernier = precedent->m_suivant;
+		}
+	}
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Enlève la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément à enlever
+ * \pre L'élément appartient à la liste
+ * \post La liste compte un élément de moins
+ */
+template<typename T>
+void Liste<T>::enleverEl(const T & p_el)
+{
+	elem precedent = m_dernier;
+	for (int i = 0; i < m_cardinalite; ++i)
+	{
+		if (precedent->m_suivant->m_el == p_el)
+		{
+			_enlever(precedent);
+			INVARIANTS();
+			return;
+		}
+		precedent = precedent->m_suivant;
+	}
+	throw std::logic_error("enleverEl: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Enlève l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ * \post La liste compte un élément de moins
+ */
+template<typename T>
+void Liste<T>::enleverPos(const int & p_pos)
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite);
+
+	_enlever(_pointeurSurNoeud(p_pos - 1));
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int Liste<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Vérifie si la liste est vide
+ */
+template<typename T>
+bool Liste<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Vérifie si un élément est dans la liste
+ * \param[in] p_el L'élément recherché
+ */
+template<typename T>
+bool Liste<T>::appartient(const T & p_el) const
+{
+	elem courant = m_dernier;
+	for (int i = 0; i < m_cardinalite; ++i)
+	{
+		courant = courant->m_suivant;
+		if (courant->m_el == p_el)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief Retourne l'élément à une position donnée
+ *
+ * \param[in] p_pos La position, de 1 à taille()
+ * \pre La position est valide
+ */
+template<typename T>
+T Liste<T>::element(const int & p_pos) const
+{
+	PRECONDITION(p_pos >= 1 && p_pos <= m_cardinalite);
+
+	return _pointeurSurNoeud(p_pos)->m_el;
+}
+
+/**
+ * \brief Retourne la position de la première occurrence d'un élément
+ *
+ * \param[in] p_el L'élément recherché
+ * \pre L'élément appartient à la liste
+ */
+template<typename T>
+int Liste<T>::position(const T & p_el) const
+{
+	elem courant = m_dernier;
+	for (int i = 1; i <= m_cardinalite; ++i)
+	{
+		courant = courant->m_suivant;
+		if (courant->m_el == p_el)
+		{
+			return i;
+		}
+	}
+	throw std::logic_error("position: l'élément n'est pas dans la liste");
+}
+
+/**
+ * \brief Fait tourner la liste
+ *
+ * L'élément à la position p_nb + 1 devient le premier; une valeur négative
+ * tourne dans l'autre sens. Seul m_dernier se déplace: aucun noeud n'est
+ * rechaîné, et tourner(1) est en O(1).
+ *
+ * \param[in] p_nb Le nombre de positions
+ * \post Les éléments gardent leur ordre circulaire
+ */
+template<typename T>
+void Liste<T>::tourner(const int & p_nb)
+{
+	if (m_cardinalite == 0)
+	{
+		return;
+	}
+
+	int pas = p_nb % m_cardinalite;
+	if (pas < 0)
+	{
+		pas += m_cardinalite;
+	}
+	m_dernier = _pointeurSurNoeud(pas);
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne l'élément courant du tourniquet, c'est-à-dire le premier
+ *
+ * \pre La liste n'est pas vide
+ */
+template<typename T>
+const T & Liste<T>::courant() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_dernier->m_suivant->m_el;
+}
+
+/**
+ * \brief Retourne l'élément courant et avance le tourniquet d'une position
+ *
+ * L'élément retourné devient le dernier de la liste, en O(1).
+ *
+ * \pre La liste n'est pas vide
+ */
+template<typename T>
+T Liste<T>::prochain()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	m_dernier = m_dernier->m_suivant;
+	return m_dernier->m_el;
+}
+
+/**
+ * \brief Enlève l'élément courant du tourniquet en O(1)
+ *
+ * L'élément suivant devient l'élément courant.
+ *
+ * \pre La liste n'est pas vide
+ */
+template<typename T>
+void Liste<T>::enleverCourant()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	_enlever(m_dernier);
+	INVARIANTS();
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et le chaînage
+ */
+template<typename T>
+void Liste<T>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT((m_cardinalite == 0) == (m_dernier == 0));
+	INVARIANT(m_dernier == 0 || m_dernier->m_suivant != 0);
+	INVARIANT(m_cardinalite != 1 || m_dernier->m_suivant == m_dernier);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne le noeud à une position donnée
+ *
+ * La position 0 désigne m_dernier, le prédécesseur du premier noeud. La
+ * dernière position est atteinte sans parcours, ce qui rend l'ajout en
+ * queue en O(1).
+ *
+ * \param[in] p_pos La position, de 0 à taille()
+ * \pre La liste n'est pas vide
+ */
+template<typename T>
+typename Liste<T>::elem Liste<T>::_pointeurSurNoeud(const int & p_pos) const
+{
+	PRECONDITION(m_dernier != 0);
+	PRECONDITION(p_pos >= 0 && p_pos <= m_cardinalite);
+
+	if (p_pos == m_cardinalite)
+	{
+		return m_dernier;
+	}
+
+	elem courant = m_dernier;
+	for (int i = 0; i < p_pos; ++i)
+	{
+		courant = courant->m_suivant;
+	}
+	return courant;
+}
+
+/**
+ * \brief Ajoute à la fin une copie de chaque élément d'une chaîne circulaire
+ *
+ * \param[in] p_dernier Le dernier noeud de la chaîne à copier, 0 si elle est vide
+ * \pre La liste courante est vide
+ */
+template<typename T>
+void Liste<T>::_copier(elem p_dernier)
+{
+	if (p_dernier == 0)
+	{
+		return;
+	}
+
+	elem source = p_dernier->m_suivant;
+	elem premier = new Noeud(source->m_el);
+	elem dernier = premier;
+	m_cardinalite = 1;
+	try
+	{
+		while (source != p_dernier)
+		{
+			source = source->m_suivant;
+			dernier->m_suivant = new Noeud(source->m_el);
+			dernier = dernier->m_suivant;
+			++m_cardinalite;
+		}
+	}
+	catch (...)
+	{
+		dernier->m_suivant = premier;
+		m_dernier = dernier;
+		throw;
+	}
+	dernier->m_suivant = premier;
+	m_dernier = dernier;
+}
+
+/**
+ * \brief Ajoute à la fin les éléments d'une séquence, en une seule passe
+ *
+ * La boucle est refermée une seule fois, à la fin (ou si une copie lance
+ * une exception, pour garder la liste cohérente).
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ */
+template<typename T>
+template<typename Iterateur>
+void Liste<T>::_ajouterPlage(Iterateur p_debut, Iterateur p_fin)
+{
+	if (p_debut == p_fin)
+	{
+		return;
+	}
+
+	elem dernier = m_dernier;
+	elem premier = (dernier == 0) ? 0 : dernier->m_suivant;
+	try
+	{
+		for (; p_debut != p_fin; ++p_debut)
+		{
+			elem nouveau = new Noeud(*p_debut);
+			if (dernier == 0)
+			{
+				premier = nouveau;
+			}
+			else
+			{
+				dernier->m_suivant = nouveau;
+			}
+			dernier = nouveau;
+			++m_cardinalite;
+		}
+	}
+	catch (...)
+	{
+		if (dernier != 0)
+		{
+			dernier->m_suivant = premier;
+		}
+		m_dernier = dernier;
+		throw;
+	}
+	dernier->m_suivant = premier;
+	m_dernier = dernier;
+}
+
+/**
+ * \brief Libère tous les noeuds
+ * \post La liste est vide
+ */
+template<typename T>
+void Liste<T>::_detruire()
+{
+	while (m_dernier != 0)
+	{
+		_enlever(m_dernier);
+	}
+}
+
+/**
+ * \brief Détache et libère le noeud qui suit p_precedent
+ *
+ * \param[in] p_precedent Le prédécesseur du noeud à enlever
+ */
+template<typename T>
+void Liste<T>::_enlever(elem p_precedent)
+{
+	elem cible = p_precedent->m_suivant;
+	if (cible == p_precedent)
+	{
+		m_dernier = 0;
+	}
+	else
+	{
+		p_precedent->m_suivant = cible->m_suivant;
+		if (cible == m_dernier)
+		{
+			m_dernier = p_precedent;
+		}
+	}
+	delete cible;
+	--m_cardinalite;
+}
+
+} //Fin du namespace
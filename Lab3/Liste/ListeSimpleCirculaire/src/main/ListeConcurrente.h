@@ -0,0 +1,91 @@
+/**
+ * \file ListeConcurrente.h
+ * \brief Classe définissant une liste ordonnée partagée entre plusieurs fils.
+ * \version 0.1
+ *
+ * Implémentation dans une liste simplement chaînée sans verrou (Harris):
+ * un noeud est d'abord marqué dans son pointeur suivant, puis détaché.
+ * Les noeuds détachés sont libérés par ReclamationEpoques.
+ */
+
+#ifndef _LISTECONCURRENTE__H
+#define _LISTECONCURRENTE__H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include "ReclamationEpoques.h"
+
+namespace lab03 {
+/**
+ * \class ListeConcurrente
+ *
+ * \brief classe générique représentant un ensemble ordonné concurrent
+ *
+ *  Les éléments sont gardés en ordre croissant (selon operator<) et sans
+ *  doublon. ajouter, enleverEl et appartient peuvent être appelés en même
+ *  temps par plusieurs fils; la construction, la destruction et
+ *  l'affichage exigent un accès exclusif.
+ */
+template<typename T>
+class ListeConcurrente
+{
+public:
+	ListeConcurrente();
+	~ListeConcurrente();
+
+	bool ajouter(const T &);
+	bool enleverEl(const T &);
+	bool appartient(const T &) const;
+
+	int taille() const;
+	bool estVide() const;
+
+	void verifieInvariant() const;
+
+	template<class U> friend std::ostream& operator <<(std::ostream &,
+			const ListeConcurrente<U> &);
+private:
+	ListeConcurrente(const ListeConcurrente &);
+	const ListeConcurrente<T> & operator =(const ListeConcurrente<T> &);
+
+	/**
+	 * \typedef typedef std::uintptr_t lien
+	 * \brief Pointeur vers un Noeud dont le bit de poids faible est la marque
+	 * de suppression logique du noeud qui contient ce lien.
+	 */
+	typedef std::uintptr_t lien;
+
+	/**
+	 * \class Noeud
+	 *
+	 * \brief Classe interne représentant un noeud (une position) dans la liste.
+	 */
+	class Noeud {
+	public:
+		T m_el; /*!<L'élément de base de la liste*/
+		std::atomic<lien> m_suivant; /*!<Le lien (marqué ou non) vers le noeud suivant*/
+
+		explicit Noeud(const T& data_item, lien next_ptr = 0) :
+				m_el(data_item), m_suivant(next_ptr) {
+		}
+	};
+
+	typedef Noeud * elem;
+
+	std::atomic<lien> m_tete; /*!< Lien vers le premier noeud, jamais marqué*/
+	std::atomic<int> m_cardinalite; /*!< Cardinalité de la liste*/
+
+	// Méthodes privées
+	bool _trouver(const T &, std::atomic<lien> *&, elem &);
+
+	static elem _pointeur(lien);
+	static lien _lien(elem);
+	static bool _estMarque(lien);
+	static void _detruireNoeud(void *);
+};
+} //Fin du namespace
+
+#include "ListeConcurrente.hpp"
+
+#endif
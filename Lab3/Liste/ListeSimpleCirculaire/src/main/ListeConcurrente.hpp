@@ -0,0 +1,319 @@
+#include "ContratException.h"
+
+namespace lab03 {
+
+/**
+ * \brief Affiche la liste
+ *
+ * \pre Aucun autre fil ne modifie la liste pendant l'affichage
+ */
+template<class U>
+std::ostream& operator <<(std::ostream & p_out, const ListeConcurrente<U> & p_source)
+{
+	p_out << "[";
+	bool premier = true;
+	typename ListeConcurrente<U>::elem courant =
+			ListeConcurrente<U>::_pointeur(p_source.m_tete.load());
+	while (courant != nullptr)
+	{
+		typename ListeConcurrente<U>::lien suivant = courant->m_suivant.load();
+		if (!ListeConcurrente<U>::_estMarque(suivant))
+		{
+			if (!premier)
+				p_out << ",";
+			p_out << courant->m_el;
+			premier = false;
+		}
+		courant = ListeConcurrente<U>::_pointeur(suivant);
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une liste vide
+ */
+template<typename T>
+ListeConcurrente<T>::ListeConcurrente() :
+	m_tete(0), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ *
+ * Les noeuds encore chaînés sont libérés directement. Les noeuds déjà
+ * détachés appartiennent à ReclamationEpoques.
+ *
+ * \pre Aucun autre fil n'utilise la liste
+ */
+template<typename T>
+ListeConcurrente<T>::~ListeConcurrente()
+{
+	elem courant = _pointeur(m_tete.load());
+	while (courant != nullptr)
+	{
+		elem suivant = _pointeur(courant->m_suivant.load());
+		delete courant;
+		courant = suivant;
+	}
+}
+
+/**
+ * \brief Ajoute un élément à sa place dans l'ordre croissant
+ *
+ * \param[in] p_el L'élément à ajouter
+ * \return false si l'élément était déjà présent
+ * \post L'élément appartient à la liste
+ */
+template<typename T>
+bool ListeConcurrente<T>::ajouter(const T & p_el)
+{
+	ReclamationEpoques::Garde garde;
+	elem nouveau = nullptr;
+	while (true)
+	{
+		std::atomic<lien> * precedent;
+		elem courant;
+		if (_trouver(p_el, precedent, courant))
+		{
+			delete nouveau;
+			return false;
+		}
+
+		if (nouveau == nullptr)
+		{
+			nouveau = new Noeud(p_el);
+		}
+		nouveau->m_suivant.store(_lien(courant), std::memory_order_relaxed);
+
+		// Échoue si le précédent a été marqué ou si un autre noeud a été inséré entre-temps.
+		lien attendu = _lien(courant);
+		if (precedent->compare_exchange_strong(attendu, _lien(nouveau),
+				std::memory_order_release, std::memory_order_relaxed))
+		{
+			m_cardinalite.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+}
+
+/**
+ * \brief Enlève un élément de la liste
+ *
+ * Le noeud est d'abord marqué (suppression logique, point de linéarisation),
+ * puis détaché. Si le détachement échoue, un parcours s'en charge.
+ *
+ * \param[in] p_el L'élément à enlever
+ * \return false si l'élément n'était pas présent
+ * \post L'élément n'appartient plus à la liste
+ */
+template<typename T>
+bool ListeConcurrente<T>::enleverEl(const T & p_el)
+{
+	ReclamationEpoques::Garde garde;
+	while (true)
+	{
+		std::atomic<lien> * precedent;
+		elem courant;
+		if (!_trouver(p_el, precedent, courant))
+		{
+			return false;
+		}
+
+		lien suivant = courant->m_suivant.load(std::memory_order_acquire);
+		if (_estMarque(suivant)
+				|| !courant->m_suivant.compare_exchange_strong(suivant, suivant | 1,
+						std::memory_order_acq_rel, std::memory_order_relaxed))
+		{
+			continue;
+		}
+		m_cardinalite.fetch_sub(1, std::memory_order_relaxed);
+
+		lien attendu = _lien(courant);
+		if (precedent->compare_exchange_strong(attendu, suivant,
+				std::memory_order_acq_rel, std::memory_order_relaxed))
+		{
+			ReclamationEpoques::instance().retirer(courant, &_detruireNoeud);
+		}
+		else
+		{
+			_trouver(p_el, precedent, courant);
+		}
+		return true;
+	}
+}
+
+/**
+ * \brief Vérifie si un élément est présent
+ *
+ * Le parcours ne modifie rien et ne recommence jamais: il traverse les
+ * noeuds marqués sans les détacher.
+ *
+ * \param[in] p_el L'élément recherché
+ * \return true si l'élément est présent et non marqué
+ */
+template<typename T>
+bool ListeConcurrente<T>::appartient(const T & p_el) const
+{
+	ReclamationEpoques::Garde garde;
+	elem courant = _pointeur(m_tete.load(std::memory_order_acquire));
+	while (courant != nullptr && courant->m_el < p_el)
+	{
+		courant = _pointeur(courant->m_suivant.load(std::memory_order_acquire));
+	}
+	return courant != nullptr && !(p_el < courant->m_el)
+			&& !_estMarque(courant->m_suivant.load(std::memory_order_acquire));
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Sous accès concurrent, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int ListeConcurrente<T>::taille() const
+{
+	return m_cardinalite.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Vérifie si la liste est vide
+ */
+template<typename T>
+bool ListeConcurrente<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Vérifie l'ordre strictement croissant et la cardinalité
+ *
+ * Les opérations ne l'appellent pas puisque l'invariant n'est observable
+ * que lorsqu'aucun autre fil ne modifie la liste.
+ */
+template<typename T>
+void ListeConcurrente<T>::verifieInvariant() const
+{
+	INVARIANT(!_estMarque(m_tete.load()));
+	int cardinalite = 0;
+	elem precedent = nullptr;
+	for (elem courant = _pointeur(m_tete.load()); courant != nullptr;
+			courant = _pointeur(courant->m_suivant.load()))
+	{
+		if (_estMarque(courant->m_suivant.load()))
+			continue;
+		INVARIANT(precedent == nullptr || precedent->m_el < courant->m_el);
+		precedent = courant;
+		++cardinalite;
+	}
+	INVARIANT(cardinalite == m_cardinalite.load());
+}
+
+// Méthodes privées
+
+/**
+ * \brief Cherche le premier noeud non marqué dont l'élément n'est pas inférieur à p_el
+ *
+ * Les noeuds marqués rencontrés sont détachés et retirés. Le parcours
+ * recommence du début si un lien précédent change sous nos pieds.
+ *
+ * \param[in] p_el L'élément recherché
+ * \param[out] p_precedent Le lien qui pointait vers p_courant
+ * \param[out] p_courant Le noeud trouvé, nullptr en fin de liste
+ * \return true si p_courant contient un élément équivalent à p_el
+ * \pre Le fil courant détient une ReclamationEpoques::Garde
+ */
+template<typename T>
+bool ListeConcurrente<T>::_trouver(const T & p_el, std::atomic<lien> *& p_precedent,
+		elem & p_courant)
+{
+	while (true)
+	{
+		std::atomic<lien> * precedent = &m_tete;
+		lien courant = precedent->load(std::memory_order_acquire);
+		bool recommencer = false;
+
+		while (!recommencer)
+		{
+			elem noeud = _pointeur(courant);
+			if (noeud == nullptr)
+			{
+				p_precedent = precedent;
+				p_courant = nullptr;
+				return false;
+			}
+
+			lien suivant = noeud->m_suivant.load(std::memory_order_acquire);
+			if (precedent->load(std::memory_order_acquire) != courant)
+			{
+				recommencer = true;
+			}
+			else if (_estMarque(suivant))
+			{
+				lien attendu = courant;
+				lien detache = suivant & ~static_cast<lien>(1);
+				if (precedent->compare_exchange_strong(attendu, detache,
+						std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					ReclamationEpoques::instance().retirer(noeud, &_detruireNoeud);
+					courant = detache;
+				}
+				else
+				{
+					recommencer = true;
+				}
+			}
+			else if (!(noeud->m_el < p_el))
+			{
+				p_precedent = precedent;
+				p_courant = noeud;
+				return !(p_el < noeud->m_el);
+			}
+			else
+			{
+				precedent = &noeud->m_suivant;
+				courant = suivant;
+			}
+		}
+	}
+}
+
+/**
+ * \brief Extrait le pointeur d'un lien en ignorant la marque
+ */
+template<typename T>
+typename ListeConcurrente<T>::elem ListeConcurrente<T>::_pointeur(lien p_lien)
+{
+	return reinterpret_cast<elem>(p_lien & ~static_cast<lien>(1));
+}
+
+/**
+ * \brief Construit un lien non marqué vers un noeud
+ */
+template<typename T>
+typename ListeConcurrente<T>::lien ListeConcurrente<T>::_lien(elem p_noeud)
+{
+	return reinterpret_cast<lien>(p_noeud);
+}
+
+/**
+ * \brief Vérifie si un lien porte la marque de suppression
+ */
+template<typename T>
+bool ListeConcurrente<T>::_estMarque(lien p_lien)
+{
+	return (p_lien & 1) != 0;
+}
+
+/**
+ * \brief Libère un noeud confié à ReclamationEpoques
+ */
+template<typename T>
+void ListeConcurrente<T>::_detruireNoeud(void * p_noeud)
+{
+	delete static_cast<elem>(p_noeud);
+}
+
+} //Fin du namespace
@@ -0,0 +1,243 @@
+/**
+ * \file ReclamationEpoques.cpp
+ * \brief Implémentation de la récupération de mémoire par époques.
+ * \version 0.1
+ */
+#include "ReclamationEpoques.h"
+
+namespace lab03 {
+
+/**
+ * \class LiberationParticipant
+ *
+ * \brief Rend l'enregistrement du fil courant au registre lorsque le fil termine.
+ */
+struct LiberationParticipant
+{
+	ReclamationEpoques::Participant * m_participant;
+
+	LiberationParticipant() :
+		m_participant(nullptr)
+	{
+	}
+
+	~LiberationParticipant()
+	{
+		if (m_participant != nullptr)
+		{
+			ReclamationEpoques::instance().collecter();
+			m_participant->m_occupe.store(false, std::memory_order_release);
+		}
+	}
+};
+
+static thread_local LiberationParticipant t_enregistrement;
+
+/**
+ * \brief Constructeur du domaine, à l'époque 0 et sans participant.
+ */
+ReclamationEpoques::ReclamationEpoques() :
+	m_epoque(0), m_participants(nullptr)
+{
+}
+
+/**
+ * \brief Destructeur du domaine
+ *
+ * Appelé à la fin du programme, lorsque plus aucun fil ne peut détenir de
+ * référence: tous les retraits en attente sont libérés.
+ */
+ReclamationEpoques::~ReclamationEpoques()
+{
+	Participant * courant = m_participants.load();
+	while (courant != nullptr)
+	{
+		Participant * suivant = courant->m_suivant;
+		for (const Retrait & retrait : courant->m_retraits)
+		{
+			retrait.m_liberer(retrait.m_ptr);
+		}
+		delete courant;
+		courant = suivant;
+	}
+}
+
+/**
+ * \brief Accès au domaine unique du programme.
+ * \return Le domaine de récupération
+ */
+ReclamationEpoques & ReclamationEpoques::instance()
+{
+	static ReclamationEpoques domaine;
+	return domaine;
+}
+
+/**
+ * \brief Confie un objet détaché de toute structure partagée au domaine.
+ *
+ * \param[in] p_ptr L'objet à libérer
+ * \param[in] p_liberer La fonction qui libère l'objet
+ * \pre L'objet n'est plus atteignable depuis la structure partagée
+ * \post L'objet sera libéré lorsque plus aucun fil ne pourra le lire
+ */
+void ReclamationEpoques::retirer(void * p_ptr, void (*p_liberer)(void *))
+{
+	Participant * participant = _participantCourant();
+	Retrait retrait = { p_ptr, p_liberer, m_epoque.load() };
+	participant->m_retraits.push_back(retrait);
+
+	if (participant->m_retraits.size() >= SEUIL_COLLECTE)
+	{
+		collecter();
+	}
+}
+
+/**
+ * \brief Tente d'avancer l'époque globale puis libère les retraits du fil
+ * courant qui sont devenus sûrs.
+ */
+void ReclamationEpoques::collecter()
+{
+	_avancer();
+	_liberer(_participantCourant(), m_epoque.load());
+}
+
+/**
+ * \brief Constructeur d'une garde: le fil courant entre en section critique.
+ */
+ReclamationEpoques::Garde::Garde()
+{
+	ReclamationEpoques::instance()._entrer();
+}
+
+/**
+ * \brief Destructeur d'une garde: le fil courant quitte la section critique.
+ */
+ReclamationEpoques::Garde::~Garde()
+{
+	ReclamationEpoques::instance()._sortir();
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne l'enregistrement du fil courant, en le créant au besoin.
+ */
+ReclamationEpoques::Participant * ReclamationEpoques::_participantCourant()
+{
+	if (t_enregistrement.m_participant == nullptr)
+	{
+		t_enregistrement.m_participant = _enregistrer();
+	}
+	return t_enregistrement.m_participant;
+}
+
+/**
+ * \brief Réutilise un enregistrement libéré par un fil terminé ou en ajoute
+ * un nouveau en tête du registre.
+ */
+ReclamationEpoques::Participant * ReclamationEpoques::_enregistrer()
+{
+	for (Participant * courant = m_participants.load(); courant != nullptr;
+			courant = courant->m_suivant)
+	{
+		bool occupe = false;
+		if (!courant->m_occupe.load(std::memory_order_relaxed)
+				&& courant->m_occupe.compare_exchange_strong(occupe, true,
+						std::memory_order_acquire))
+		{
+			return courant;
+		}
+	}
+
+	Participant * nouveau = new Participant();
+	Participant * tete = m_participants.load();
+	do
+	{
+		nouveau->m_suivant = tete;
+	} while (!m_participants.compare_exchange_weak(tete, nouveau));
+	return nouveau;
+}
+
+/**
+ * \brief Annonce l'époque globale courante pour le fil courant.
+ *
+ * L'annonce est recommencée si l'époque a avancé entre la lecture et la
+ * publication: ainsi l'époque annoncée a été l'époque globale après que
+ * l'annonce fut visible.
+ */
+void ReclamationEpoques::_entrer()
+{
+	Participant * participant = _participantCourant();
+	if (participant->m_imbrication++ > 0)
+	{
+		return;
+	}
+
+	std::uint64_t epoque;
+	do
+	{
+		epoque = m_epoque.load();
+		participant->m_etat.store((epoque << 1) | 1);
+	} while (m_epoque.load() != epoque);
+}
+
+/**
+ * \brief Retire l'annonce du fil courant à la sortie de la garde la plus externe.
+ */
+void ReclamationEpoques::_sortir()
+{
+	Participant * participant = _participantCourant();
+	if (--participant->m_imbrication == 0)
+	{
+		std::uint64_t etat = participant->m_etat.load(std::memory_order_relaxed);
+		participant->m_etat.store(etat & ~static_cast<std::uint64_t>(1),
+				std::memory_order_release);
+	}
+}
+
+/**
+ * \brief Avance l'époque globale si tous les fils en section critique ont
+ * annoncé l'époque courante.
+ * \return true si l'époque a avancé
+ */
+bool ReclamationEpoques::_avancer()
+{
+	std::uint64_t epoque = m_epoque.load();
+	for (Participant * courant = m_participants.load(); courant != nullptr;
+			courant = courant->m_suivant)
+	{
+		std::uint64_t etat = courant->m_etat.load();
+		if ((etat & 1) && (etat >> 1) != epoque)
+		{
+			return false;
+		}
+	}
+	return m_epoque.compare_exchange_strong(epoque, epoque + 1);
+}
+
+/**
+ * \brief Libère les retraits d'un participant datant d'au moins deux époques.
+ *
+ * \param[in] p_participant Le participant, qui doit appartenir au fil courant
+ * \param[in] p_epoque L'époque globale courante
+ */
+void ReclamationEpoques::_liberer(Participant * p_participant, std::uint64_t p_epoque)
+{
+	std::vector<Retrait> & retraits = p_participant->m_retraits;
+	std::size_t conserves = 0;
+	for (std::size_t i = 0; i < retraits.size(); ++i)
+	{
+		if (retraits[i].m_epoque + 2 <= p_epoque)
+		{
+			retraits[i].m_liberer(retraits[i].m_ptr);
+		}
+		else
+		{
+			retraits[conserves++] = retraits[i];
+		}
+	}
+	retraits.resize(conserves);
+}
+
+} //Fin du namespace
@@ -0,0 +1,114 @@
+/**
+ * \file ReclamationEpoques.h
+ * \brief Récupération de mémoire par époques pour les structures sans verrou.
+ * \version 0.1
+ *
+ * Un noeud retiré d'une structure partagée ne peut pas être libéré tout de
+ * suite: un autre fil peut encore être en train de le lire. Chaque fil
+ * annonce l'époque globale lorsqu'il entre dans une section critique; un
+ * noeud retiré à l'époque e n'est libéré qu'une fois l'époque globale
+ * rendue à e + 2, c'est-à-dire lorsque plus aucun fil ne peut le référencer.
+ */
+
+#ifndef _RECLAMATIONEPOQUES_H
+#define _RECLAMATIONEPOQUES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lab03 {
+/**
+ * \class ReclamationEpoques
+ *
+ * \brief Domaine global de récupération de mémoire par époques.
+ *
+ *  Les fils s'enregistrent automatiquement au premier usage. Un fil qui
+ *  termine libère son enregistrement, qui sera réutilisé (avec les retraits
+ *  en attente) par le prochain fil.
+ */
+class ReclamationEpoques
+{
+public:
+	/**
+	 * \class Garde
+	 *
+	 * \brief Section critique: tant qu'une garde existe, aucun noeud lu par
+	 * le fil courant ne sera libéré. Les gardes peuvent être imbriquées.
+	 */
+	class Garde
+	{
+	public:
+		Garde();
+		~Garde();
+	private:
+		Garde(const Garde &);
+		Garde & operator =(const Garde &);
+	};
+
+	static ReclamationEpoques & instance();
+
+	void retirer(void *, void (*)(void *));
+	void collecter();
+
+	~ReclamationEpoques();
+
+private:
+	/**
+	 * \class Retrait
+	 *
+	 * \brief Un pointeur en attente de libération et l'époque de son retrait.
+	 */
+	struct Retrait
+	{
+		void * m_ptr; /*!< L'objet à libérer*/
+		void (*m_liberer)(void *); /*!< La fonction qui libère l'objet*/
+		std::uint64_t m_epoque; /*!< L'époque globale au moment du retrait*/
+	};
+
+	/**
+	 * \class Participant
+	 *
+	 * \brief L'enregistrement d'un fil dans le domaine.
+	 *
+	 *  m_etat contient l'époque annoncée décalée d'un bit; le bit de poids
+	 *  faible indique que le fil est dans une section critique.
+	 */
+	struct Participant
+	{
+		std::atomic<std::uint64_t> m_etat; /*!< Époque annoncée et bit actif*/
+		std::atomic<bool> m_occupe; /*!< Vrai si un fil possède l'enregistrement*/
+		int m_imbrication; /*!< Profondeur des gardes du fil propriétaire*/
+		std::vector<Retrait> m_retraits; /*!< Retraits en attente du fil*/
+		Participant * m_suivant; /*!< Participant suivant dans le registre*/
+
+		Participant() :
+			m_etat(0), m_occupe(true), m_imbrication(0), m_suivant(nullptr)
+		{
+		}
+	};
+
+	ReclamationEpoques();
+	ReclamationEpoques(const ReclamationEpoques &);
+	ReclamationEpoques & operator =(const ReclamationEpoques &);
+
+	std::atomic<std::uint64_t> m_epoque; /*!< L'époque globale*/
+	std::atomic<Participant *> m_participants; /*!< Registre des fils (ajout en tête seulement)*/
+
+	static const std::size_t SEUIL_COLLECTE = 64; /*!< Retraits accumulés avant une collecte*/
+
+	// Méthodes privées
+	Participant * _participantCourant();
+	Participant * _enregistrer();
+	void _entrer();
+	void _sortir();
+	bool _avancer();
+	void _liberer(Participant *, std::uint64_t);
+
+	friend class Garde;
+	friend struct LiberationParticipant;
+};
+} //Fin du namespace
+
+#endif
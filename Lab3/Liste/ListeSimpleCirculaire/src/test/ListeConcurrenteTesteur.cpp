@@ -0,0 +1,135 @@
+/**
+ * \file ListeConcurrenteTesteur.cpp
+ * \brief Les tests unitaires de ListeConcurrente.
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour ListeConcurrente
+ */
+
+#include "gtest/gtest.h"
+#include "../main/ListeConcurrente.h"
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace lab03;
+
+static const int NB_FILS = 8;
+static const int NB_PAR_FIL = 2000;
+
+class ListeConcurrenteTest: public ::testing::Test
+{
+protected:
+	virtual void SetUp() {
+		liste.ajouter(20);
+		liste.ajouter(10);
+		liste.ajouter(30);
+	}
+	ListeConcurrente<int> listeVide;
+	ListeConcurrente<int> liste;
+};
+
+TEST_F(ListeConcurrenteTest, constructeurVideOK)
+{
+	EXPECT_EQ(0, listeVide.taille());
+	EXPECT_TRUE(listeVide.estVide());
+	EXPECT_FALSE(listeVide.appartient(10));
+}
+
+TEST_F(ListeConcurrenteTest, ajouterGardeOrdreCroissant)
+{
+	std::ostringstream oss;
+	oss << liste;
+	EXPECT_EQ("[10,20,30]", oss.str());
+	EXPECT_EQ(3, liste.taille());
+	liste.verifieInvariant();
+}
+
+TEST_F(ListeConcurrenteTest, ajouterDoublonRefuse)
+{
+	EXPECT_FALSE(liste.ajouter(20));
+	EXPECT_EQ(3, liste.taille());
+}
+
+TEST_F(ListeConcurrenteTest, enleverElOK)
+{
+	EXPECT_TRUE(liste.enleverEl(20));
+	EXPECT_FALSE(liste.appartient(20));
+	EXPECT_TRUE(liste.appartient(10));
+	EXPECT_TRUE(liste.appartient(30));
+	EXPECT_EQ(2, liste.taille());
+	EXPECT_FALSE(liste.enleverEl(20));
+	EXPECT_FALSE(listeVide.enleverEl(20));
+	liste.verifieInvariant();
+}
+
+TEST_F(ListeConcurrenteTest, ajoutsConcurrentsDisjoints)
+{
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+				listeVide.ajouter(i * NB_FILS + f);
+		}));
+	}
+	for (std::thread & fil : fils)
+		fil.join();
+
+	EXPECT_EQ(NB_FILS * NB_PAR_FIL, listeVide.taille());
+	for (int i = 0; i < NB_FILS * NB_PAR_FIL; ++i)
+		EXPECT_TRUE(listeVide.appartient(i));
+	listeVide.verifieInvariant();
+}
+
+TEST_F(ListeConcurrenteTest, ajoutsConcurrentsMemesElements)
+{
+	std::vector<std::thread> fils;
+	std::vector<int> reussites(NB_FILS, 0);
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f, &reussites]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+				if (listeVide.ajouter(i))
+					++reussites[f];
+		}));
+	}
+	for (std::thread & fil : fils)
+		fil.join();
+
+	int total = 0;
+	for (int r : reussites)
+		total += r;
+	EXPECT_EQ(NB_PAR_FIL, total);
+	EXPECT_EQ(NB_PAR_FIL, listeVide.taille());
+	listeVide.verifieInvariant();
+}
+
+TEST_F(ListeConcurrenteTest, ajoutsEtRetraitsConcurrents)
+{
+	for (int i = 0; i < NB_FILS * NB_PAR_FIL; i += 2)
+		listeVide.ajouter(i);
+
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+			{
+				int valeur = i * NB_FILS + f;
+				if (valeur % 2 == 0)
+					listeVide.enleverEl(valeur);
+				else
+					listeVide.ajouter(valeur);
+				listeVide.appartient(valeur + 1);
+			}
+		}));
+	}
+	for (std::thread & fil : fils)
+		fil.join();
+
+	EXPECT_EQ(NB_FILS * NB_PAR_FIL / 2, listeVide.taille());
+	for (int i = 0; i < NB_FILS * NB_PAR_FIL; ++i)
+		EXPECT_EQ(i % 2 == 1, listeVide.appartient(i));
+	listeVide.verifieInvariant();
+}
@@ -11,6 +11,8 @@
 
 #include "gtest/gtest.h"
 #include "../main/Liste.h"
+#include <utility>
+#include <vector>
 
 using namespace lab03;
 
@@ -279,3 +281,119 @@ TEST_F(ListeTest, afficherOk)
 {
 	std::cout << liste << std::endl;
 }
+
+TEST_F(ListeTest, tournerOK)
+{
+	liste.tourner(1);
+	EXPECT_EQ(20, liste.element(1));
+	EXPECT_EQ(30, liste.element(2));
+	EXPECT_EQ(10, liste.element(3));
+
+	liste.tourner(-1);
+	EXPECT_EQ(10, liste.element(1));
+
+	liste.tourner(5);
+	EXPECT_EQ(30, liste.element(1));
+	EXPECT_EQ(3, liste.taille());
+
+	listeVide.tourner(2);
+	EXPECT_TRUE(listeVide.estVide());
+}
+
+TEST_F(ListeTest, tourniquetProchainOK)
+{
+	EXPECT_EQ(10, liste.courant());
+	EXPECT_EQ(10, liste.prochain());
+	EXPECT_EQ(20, liste.prochain());
+	EXPECT_EQ(30, liste.prochain());
+	EXPECT_EQ(10, liste.prochain());
+	EXPECT_EQ(20, liste.courant());
+	EXPECT_EQ(3, liste.taille());
+
+	EXPECT_THROW(listeVide.courant(), PreconditionException);
+	EXPECT_THROW(listeVide.prochain(), PreconditionException);
+}
+
+TEST_F(ListeTest, tourniquetEnleverCourantOK)
+{
+	liste.prochain();
+	liste.enleverCourant();
+	EXPECT_FALSE(liste.appartient(20));
+	EXPECT_EQ(30, liste.courant());
+	EXPECT_EQ(2, liste.taille());
+
+	liste.enleverCourant();
+	EXPECT_EQ(10, liste.courant());
+	liste.enleverCourant();
+	EXPECT_TRUE(liste.estVide());
+
+	EXPECT_THROW(liste.enleverCourant(), PreconditionException);
+}
+
+TEST_F(ListeTest, ajouterApresTournerOK)
+{
+	liste.tourner(2);
+	liste.ajouter(40, 4);
+	EXPECT_EQ(30, liste.element(1));
+	EXPECT_EQ(40, liste.element(4));
+	EXPECT_EQ(30, liste.prochain());
+	EXPECT_EQ(10, liste.courant());
+}
+
+TEST_F(ListeTest, ConstructeurDeplacementOK)
+{
+	Liste<int> liste2(std::move(liste));
+
+	EXPECT_EQ(3, liste2.taille());
+	EXPECT_EQ(10, liste2.element(1));
+	EXPECT_EQ(30, liste2.element(3));
+	EXPECT_TRUE(liste.estVide());
+
+	liste.ajouter(40, 1);
+	EXPECT_EQ(1, liste.taille());
+}
+
+TEST_F(ListeTest, OperateurAssignationDeplacementOK)
+{
+	Liste<int> liste2;
+	liste2.ajouter(40, 1);
+	liste2 = std::move(liste);
+
+	EXPECT_EQ(3, liste2.taille());
+	EXPECT_FALSE(liste2.appartient(40));
+	EXPECT_EQ(20, liste2.element(2));
+	EXPECT_TRUE(liste.estVide());
+}
+
+TEST_F(ListeTest, ConstructeurSequenceOK)
+{
+	std::vector<int> valeurs = { 5, 6, 7, 8 };
+	Liste<int> liste2(valeurs.begin(), valeurs.end());
+
+	EXPECT_EQ(4, liste2.taille());
+	EXPECT_EQ(1, liste2.position(5));
+	EXPECT_EQ(4, liste2.position(8));
+
+	Liste<int> liste3(valeurs.end(), valeurs.end());
+	EXPECT_TRUE(liste3.estVide());
+}
+
+TEST_F(ListeTest, assignerOK)
+{
+	std::vector<int> longue = { 1, 2, 3, 4, 5 };
+	liste.assigner(longue.begin(), longue.end());
+	EXPECT_EQ(5, liste.taille());
+	EXPECT_EQ(1, liste.element(1));
+	EXPECT_EQ(5, liste.element(5));
+
+	std::vector<int> courte = { 9, 8 };
+	liste.assigner(courte.begin(), courte.end());
+	EXPECT_EQ(2, liste.taille());
+	EXPECT_EQ(9, liste.element(1));
+	EXPECT_EQ(8, liste.element(2));
+	liste.ajouter(7, 3);
+	EXPECT_EQ(3, liste.position(7));
+
+	liste.assigner(courte.end(), courte.end());
+	EXPECT_TRUE(liste.estVide());
+}
@@ -0,0 +1,135 @@
+/**
+ * \file CompteurCache.h
+ * \brief Compteur matériel de défauts de cache pour les bancs d'essai.
+ * \version 0.1
+ *
+ * Sous Linux, le compteur PERF_COUNT_HW_CACHE_MISSES est ouvert avec
+ * perf_event_open pour le fil courant (espace utilisateur seulement).
+ * Ailleurs, ou si le noyau refuse l'accès (perf_event_paranoid, conteneur),
+ * le compteur est simplement indisponible et rien n'est publié.
+ */
+
+#ifndef _COMPTEURCACHE_H
+#define _COMPTEURCACHE_H
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * \class CompteurCache
+ *
+ * \brief Compte les défauts de cache entre demarrer() et arreter().
+ */
+class CompteurCache
+{
+public:
+	CompteurCache() :
+		m_fd(-1)
+	{
+#if defined(__linux__)
+		perf_event_attr attributs;
+		std::memset(&attributs, 0, sizeof(attributs));
+		attributs.type = PERF_TYPE_HARDWARE;
+		attributs.size = sizeof(attributs);
+		attributs.config = PERF_COUNT_HW_CACHE_MISSES;
+		attributs.disabled = 1;
+		attributs.exclude_kernel = 1;
+		attributs.exclude_hv = 1;
+		m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attributs, 0, -1, -1, 0));
+#endif
+	}
+
+	~CompteurCache()
+	{
+#if defined(__linux__)
+		if (m_fd >= 0)
+			close(m_fd);
+#endif
+	}
+
+	bool estDisponible() const
+	{
+		return m_fd >= 0;
+	}
+
+	void demarrer()
+	{
+#if defined(__linux__)
+		if (m_fd >= 0)
+		{
+			ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	void arreter()
+	{
+#if defined(__linux__)
+		if (m_fd >= 0)
+			ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+	}
+
+	/**
+	 * \brief Publie les défauts de cache par itération dans le banc d'essai
+	 */
+	void publier(benchmark::State & p_etat) const
+	{
+#if defined(__linux__)
+		std::uint64_t valeur = 0;
+		if (m_fd >= 0 && read(m_fd, &valeur, sizeof(valeur)) == sizeof(valeur))
+		{
+			p_etat.counters["defauts-cache"] = benchmark::Counter(
+					static_cast<double>(valeur), benchmark::Counter::kAvgIterations);
+		}
+#else
+		(void) p_etat;
+#endif
+	}
+
+private:
+	CompteurCache(const CompteurCache &);
+	CompteurCache & operator =(const CompteurCache &);
+
+	int m_fd; /*!< Descripteur perf_event, -1 si indisponible*/
+};
+
+/**
+ * \class MesureCache
+ *
+ * \brief Compte les défauts de cache pendant toute la portée de la boucle
+ * d'un banc d'essai et les publie à la sortie.
+ */
+class MesureCache
+{
+public:
+	explicit MesureCache(benchmark::State & p_etat) :
+		m_etat(p_etat)
+	{
+		m_compteur.demarrer();
+	}
+
+	~MesureCache()
+	{
+		m_compteur.arreter();
+		m_compteur.publier(m_etat);
+	}
+
+private:
+	MesureCache(const MesureCache &);
+	MesureCache & operator =(const MesureCache &);
+
+	benchmark::State & m_etat; /*!< Le banc d'essai qui reçoit le compteur*/
+	CompteurCache m_compteur; /*!< Le compteur matériel*/
+};
+
+#endif
@@ -0,0 +1,545 @@
+/**
+ * \file FileBanc.cpp
+ * \brief Bancs d'essai de File comparée aux conteneurs de la STL.
+ * \version 0.1
+ *
+ * Mesure enfiler, defiler, le régime permanent (un enfiler et un defiler
+ * par élément, ce qui fait tourner les indices), la copie et le parcours
+ * pour File, FileAnneau, FileDouble, FileMiroir, std::queue (sur std::deque et sur std::list) et std::deque.
+ * Les défauts de cache sont publiés lorsque les compteurs perf sont accessibles.
+ * FileInstrumentee, au régime permanent, mesure le coût de la télémétrie
+ * (deux lectures d'horloge et quelques compteurs atomiques par élément);
+ * FileEchantillonnee ne mesure l'attente que d'un élément sur 64.
+ *
+ * BM_parLots refait BM_regimePermanent sur File avec enfilerN et defilerN,
+ * par lots dont la taille est le second argument.
+ *
+ * BM_transfert fait passer des éléments d'un fil producteur à un fil
+ * consommateur: FileSPSC et FileMPMC face à File protégée par un mutex
+ * (sondée) et à FileBloquante (qui endort les fils).
+ *
+ * BM_partagee fait enfiler puis défiler un élément par chaque fil, de 1 à
+ * 64 fils: FileFragmentee face à FileMPMC et à File protégée par un mutex.
+ *
+ * BM_priorite enfile des clés pseudo-aléatoires puis les défile toutes:
+ * FileDePriorite face à std::priority_queue et à une std::list gardée
+ * triée par insertion, la représentation de l'ordonnanceur actuel.
+ */
+
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+#include <thread>
+#include "CompteurCache.h"
+#include "../main/File.h"
+#include "../main/FileAnneau.h"
+#include "../main/FileBloquante.h"
+#include "../main/FileDePriorite.h"
+#include "../main/FileDouble.h"
+#include "../main/FileFragmentee.h"
+#include "../main/FileInstrumentee.h"
+#include "../main/FileMiroir.h"
+#include "../main/FileMPMC.h"
+#include "../main/FileSPSC.h"
+#include "../main/RoueTemporelle.h"
+
+using namespace lab04;
+
+namespace
+{
+/**
+ * \class Operations
+ *
+ * \brief Adapte l'interface de chaque conteneur aux opérations mesurées.
+ */
+template<typename C>
+struct Operations;
+
+template<>
+struct Operations<File<int> >
+{
+	static File<int> * creer(int p_capacite) { return new File<int>(p_capacite); }
+	static void enfiler(File<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(File<int> & p_c) { return p_c.defiler(); }
+	static int acces(const File<int> & p_c, int p_i) { return p_c[p_i]; }
+};
+
+template<>
+struct Operations<FileAnneau<int> >
+{
+	static FileAnneau<int> * creer(int) { return new FileAnneau<int>(); }
+	static void enfiler(FileAnneau<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileAnneau<int> & p_c) { return p_c.defiler(); }
+	static int acces(const FileAnneau<int> & p_c, int p_i) { return p_c[p_i]; }
+};
+
+template<>
+struct Operations<FileDouble<int> >
+{
+	static FileDouble<int> * creer(int) { return new FileDouble<int>(); }
+	static void enfiler(FileDouble<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileDouble<int> & p_c) { return p_c.defiler(); }
+	static int acces(const FileDouble<int> & p_c, int p_i) { return p_c[p_i]; }
+};
+
+template<>
+struct Operations<FileInstrumentee<int> >
+{
+	static FileInstrumentee<int> * creer(int p_capacite) { return new FileInstrumentee<int>(p_capacite); }
+	static void enfiler(FileInstrumentee<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileInstrumentee<int> & p_c) { return p_c.defiler(); }
+};
+
+/**
+ * \class FileEchantillonnee
+ *
+ * \brief FileInstrumentee qui n'horodate qu'un élément sur 64.
+ */
+class FileEchantillonnee: public FileInstrumentee<int>
+{
+public:
+	explicit FileEchantillonnee(int p_capacite) :
+		FileInstrumentee<int>(p_capacite, 64)
+	{
+	}
+};
+
+template<>
+struct Operations<FileEchantillonnee>
+{
+	static FileEchantillonnee * creer(int p_capacite) { return new FileEchantillonnee(p_capacite); }
+	static void enfiler(FileEchantillonnee & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileEchantillonnee & p_c) { return p_c.defiler(); }
+};
+
+template<>
+struct Operations<FileMiroir<int> >
+{
+	static FileMiroir<int> * creer(int p_capacite) { return new FileMiroir<int>(p_capacite); }
+	static void enfiler(FileMiroir<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileMiroir<int> & p_c) { return p_c.defiler(); }
+	static int acces(const FileMiroir<int> & p_c, int p_i) { return p_c[p_i]; }
+};
+
+template<typename S>
+struct Operations<std::queue<int, S> >
+{
+	static std::queue<int, S> * creer(int) { return new std::queue<int, S>(); }
+	static void enfiler(std::queue<int, S> & p_c, int p_el) { p_c.push(p_el); }
+	static int defiler(std::queue<int, S> & p_c) { int el = p_c.front(); p_c.pop(); return el; }
+};
+
+template<>
+struct Operations<std::deque<int> >
+{
+	static std::deque<int> * creer(int) { return new std::deque<int>(); }
+	static void enfiler(std::deque<int> & p_c, int p_el) { p_c.push_back(p_el); }
+	static int defiler(std::deque<int> & p_c) { int el = p_c.front(); p_c.pop_front(); return el; }
+	static int acces(const std::deque<int> & p_c, int p_i) { return p_c[p_i]; }
+};
+
+template<typename C>
+void remplir(C & p_c, int p_n)
+{
+	for (int i = 0; i < p_n; ++i)
+		Operations<C>::enfiler(p_c, i);
+}
+
+template<typename C>
+void BM_enfiler(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		std::unique_ptr<C> c(Operations<C>::creer(n));
+		remplir(*c, n);
+		benchmark::DoNotOptimize(c.get());
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_enfilerDefiler(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		std::unique_ptr<C> c(Operations<C>::creer(n));
+		remplir(*c, n);
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += Operations<C>::defiler(*c);
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+template<typename C>
+void BM_regimePermanent(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	std::unique_ptr<C> c(Operations<C>::creer(n));
+	remplir(*c, n / 2);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			Operations<C>::enfiler(*c, i);
+			somme += Operations<C>::defiler(*c);
+		}
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+void BM_parLots(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	const int lot = static_cast<int>(p_etat.range(1));
+	File<int> file(n);
+	remplir(file, n / 2);
+	std::vector<int> tampon(lot);
+	for (int i = 0; i < lot; ++i)
+		tampon[i] = i;
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		for (int i = 0; i < n; i += lot)
+		{
+			file.enfilerN(tampon.data(), tampon.data() + lot);
+			file.defilerN(tampon.data(), lot);
+		}
+		benchmark::DoNotOptimize(tampon.data());
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+template<typename C>
+void BM_copie(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	std::unique_ptr<C> source(Operations<C>::creer(n));
+	remplir(*source, n / 2);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C copie(*source);
+		benchmark::DoNotOptimize(&copie);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * (n / 2));
+}
+
+template<typename C>
+void BM_parcours(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	std::unique_ptr<C> source(Operations<C>::creer(n));
+	remplir(*source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += Operations<C>::acces(*source, i);
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+/**
+ * \class FileMutex
+ *
+ * \brief File protégée par un seul mutex, la référence de BM_transfert.
+ */
+class FileMutex
+{
+public:
+	explicit FileMutex(int p_capacite) :
+		m_file(p_capacite)
+	{
+	}
+
+	bool enfiler(int p_el)
+	{
+		std::lock_guard<std::mutex> garde(m_verrou);
+		if (m_file.estPleine())
+			return false;
+		m_file.enfiler(p_el);
+		return true;
+	}
+
+	bool defiler(int & p_el)
+	{
+		std::lock_guard<std::mutex> garde(m_verrou);
+		if (m_file.estVide())
+			return false;
+		p_el = m_file.defiler();
+		return true;
+	}
+
+private:
+	std::mutex m_verrou;
+	File<int> m_file;
+};
+
+template<typename C>
+void BM_transfert(benchmark::State & p_etat)
+{
+	static C * canal = 0;
+	if (p_etat.thread_index() == 0)
+		canal = new C(1024);
+	int el = 0;
+	if (p_etat.thread_index() == 0)
+	{
+		for (auto _ : p_etat)
+			while (!canal->enfiler(el))
+				std::this_thread::yield();
+	}
+	else
+	{
+		for (auto _ : p_etat)
+			while (!canal->defiler(el))
+				std::this_thread::yield();
+	}
+	benchmark::DoNotOptimize(el);
+	p_etat.SetItemsProcessed(p_etat.iterations());
+	if (p_etat.thread_index() == 0)
+	{
+		delete canal;
+		canal = 0;
+	}
+}
+
+/**
+ * \class OperationsPriorite
+ *
+ * \brief Adapte l'interface de chaque file de priorité à BM_priorite.
+ */
+template<typename C>
+struct OperationsPriorite;
+
+template<>
+struct OperationsPriorite<FileDePriorite<int> >
+{
+	static void enfiler(FileDePriorite<int> & p_c, int p_el) { p_c.enfiler(p_el); }
+	static int defiler(FileDePriorite<int> & p_c) { return p_c.defiler(); }
+};
+
+template<>
+struct OperationsPriorite<std::priority_queue<int, std::vector<int>, std::greater<int> > >
+{
+	typedef std::priority_queue<int, std::vector<int>, std::greater<int> > C;
+	static void enfiler(C & p_c, int p_el) { p_c.push(p_el); }
+	static int defiler(C & p_c) { int el = p_c.top(); p_c.pop(); return el; }
+};
+
+template<>
+struct OperationsPriorite<std::list<int> >
+{
+	static void enfiler(std::list<int> & p_c, int p_el)
+	{
+		std::list<int>::iterator it = p_c.begin();
+		while (it != p_c.end() && *it <= p_el)
+			++it;
+		p_c.insert(it, p_el);
+	}
+	static int defiler(std::list<int> & p_c) { int el = p_c.front(); p_c.pop_front(); return el; }
+};
+
+template<typename C>
+void BM_priorite(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C c;
+		unsigned int cle = 12345u;
+		for (int i = 0; i < n; ++i)
+		{
+			cle = cle * 1103515245u + 12345u;
+			OperationsPriorite<C>::enfiler(c, static_cast<int>(cle >> 8));
+		}
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += OperationsPriorite<C>::defiler(c);
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+/**
+ * \class MinuteriesTriees
+ *
+ * \brief Minuteries dans une std::multimap triée par échéance, la référence de BM_minuteries.
+ */
+class MinuteriesTriees
+{
+public:
+	typedef std::multimap<RoueTemporelle<int>::Temps, int>::iterator Poignee;
+
+	MinuteriesTriees() :
+		m_maintenant(0)
+	{
+	}
+
+	Poignee planifier(int p_el, RoueTemporelle<int>::Temps p_delai)
+	{
+		return m_minuteries.insert(std::make_pair(m_maintenant + p_delai, p_el));
+	}
+
+	void annuler(Poignee p_poignee)
+	{
+		m_minuteries.erase(p_poignee);
+	}
+
+	template<typename Sortie>
+	int avancer(RoueTemporelle<int>::Temps p_tops, Sortie p_sortie)
+	{
+		m_maintenant += p_tops;
+		int echues = 0;
+		while (!m_minuteries.empty() && m_minuteries.begin()->first <= m_maintenant)
+		{
+			*p_sortie++ = m_minuteries.begin()->second;
+			m_minuteries.erase(m_minuteries.begin());
+			++echues;
+		}
+		return echues;
+	}
+
+	bool estVide() const
+	{
+		return m_minuteries.empty();
+	}
+
+private:
+	std::multimap<RoueTemporelle<int>::Temps, int> m_minuteries;
+	RoueTemporelle<int>::Temps m_maintenant;
+};
+
+template<typename C>
+void BM_minuteries(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	std::vector<typename C::Poignee> poignees(n);
+	std::vector<int> echues;
+	echues.reserve(n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C minuteries;
+		unsigned int cle = 12345u;
+		for (int i = 0; i < n; ++i)
+		{
+			cle = cle * 1103515245u + 12345u;
+			poignees[i] = minuteries.planifier(i, 1 + (cle >> 8) % 100000);
+		}
+		for (int i = 0; i < n; i += 2)
+			minuteries.annuler(poignees[i]);
+		echues.clear();
+		while (!minuteries.estVide())
+			minuteries.avancer(1000, std::back_inserter(echues));
+		benchmark::DoNotOptimize(echues.data());
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_partagee(benchmark::State & p_etat)
+{
+	static C * partagee = 0;
+	if (p_etat.thread_index() == 0)
+		partagee = new C(1024);
+	int el = 0;
+	for (auto _ : p_etat)
+	{
+		while (!partagee->enfiler(p_etat.thread_index()))
+			std::this_thread::yield();
+		while (!partagee->defiler(el))
+			std::this_thread::yield();
+	}
+	benchmark::DoNotOptimize(el);
+	p_etat.SetItemsProcessed(p_etat.iterations() * 2);
+	if (p_etat.thread_index() == 0)
+	{
+		delete partagee;
+		partagee = 0;
+	}
+}
+
+typedef std::priority_queue<int, std::vector<int>, std::greater<int> > MonceauBinaire;
+typedef std::list<int> ListeTriee;
+typedef std::queue<int> FileDeque;
+typedef std::queue<int, std::list<int> > FileListe;
+
+} // namespace
+
+#define BANC_FILE(banc, conteneur) \
+	BENCHMARK_TEMPLATE(banc, conteneur)->RangeMultiplier(8)->Range(8, 1 << 15)
+
+BANC_FILE(BM_enfiler, File<int>);
+BANC_FILE(BM_enfiler, FileAnneau<int>);
+BANC_FILE(BM_enfiler, FileDouble<int>);
+BANC_FILE(BM_enfiler, FileDeque);
+BANC_FILE(BM_enfiler, FileListe);
+BANC_FILE(BM_enfiler, std::deque<int>);
+
+BANC_FILE(BM_enfilerDefiler, File<int>);
+BANC_FILE(BM_enfilerDefiler, FileAnneau<int>);
+BANC_FILE(BM_enfilerDefiler, FileDeque);
+BANC_FILE(BM_enfilerDefiler, FileListe);
+BANC_FILE(BM_enfilerDefiler, std::deque<int>);
+
+BANC_FILE(BM_regimePermanent, File<int>);
+BANC_FILE(BM_regimePermanent, FileAnneau<int>);
+BANC_FILE(BM_regimePermanent, FileDouble<int>);
+BANC_FILE(BM_regimePermanent, FileInstrumentee<int>);
+BANC_FILE(BM_regimePermanent, FileEchantillonnee);
+BANC_FILE(BM_regimePermanent, FileMiroir<int>);
+BANC_FILE(BM_regimePermanent, FileDeque);
+BANC_FILE(BM_regimePermanent, FileListe);
+BANC_FILE(BM_regimePermanent, std::deque<int>);
+
+BENCHMARK(BM_parLots)->ArgsProduct({ { 1 << 12, 1 << 15 }, { 1, 16, 256 } });
+
+// La copie d'une File à moitié pleine: File et FileAnneau ne copient que
+// les éléments présents, en au plus deux blocs.
+BANC_FILE(BM_copie, File<int>);
+BANC_FILE(BM_copie, FileAnneau<int>);
+BANC_FILE(BM_copie, FileDeque);
+BANC_FILE(BM_copie, FileListe);
+BANC_FILE(BM_copie, std::deque<int>);
+
+BANC_FILE(BM_parcours, File<int>);
+BANC_FILE(BM_parcours, FileAnneau<int>);
+BANC_FILE(BM_parcours, FileDouble<int>);
+BANC_FILE(BM_parcours, FileMiroir<int>);
+BANC_FILE(BM_parcours, std::deque<int>);
+
+BANC_FILE(BM_priorite, FileDePriorite<int>);
+BANC_FILE(BM_priorite, MonceauBinaire);
+BENCHMARK_TEMPLATE(BM_priorite, ListeTriee)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+BANC_FILE(BM_minuteries, RoueTemporelle<int>);
+BANC_FILE(BM_minuteries, MinuteriesTriees);
+
+BENCHMARK_TEMPLATE(BM_transfert, FileSPSC<int>)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_transfert, FileMPMC<int>)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_transfert, FileMutex)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_transfert, FileBloquante<int>)->Threads(2)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_partagee, FileFragmentee<int>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_partagee, FileMPMC<int>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_partagee, FileMutex)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
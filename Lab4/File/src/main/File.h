@@ -13,8 +13,13 @@
 #ifndef _FILE_H
 #define _FILE_H
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace lab04 {
 /**
@@ -34,10 +39,15 @@ public:
 
 	File(const File<T> &);
 	const File<T> & operator =(const File<T> &);
+	File(File<T> &&) noexcept;
+	const File<T> & operator =(File<T> &&) noexcept;
 
 	void enfiler(const T &);
 	T defiler();
 
+	template<typename Iterateur> void enfilerN(Iterateur, Iterateur);
+	template<typename Sortie> int defilerN(Sortie, const int &);
+
 	int taille() const;
 	bool estVide() const;
 	bool estPleine() const;
@@ -57,6 +67,22 @@ private:
 	int m_cardinalite; /*!< Nombre d'éléments effectifs dans la file*/
 	static const int MAX_FILE = 100; /*!< Capacité de la file par défaut*/
     void destruct();
+    void copy(const File<T> &);
+
+    /**
+     * \brief Vrai si un bloc peut passer par memcpy entre P et le tableau
+     */
+    template<typename P>
+    struct estBlocBrut : std::integral_constant<bool,
+            std::is_trivially_copyable<T>::value && std::is_pointer<P>::value
+            && std::is_same<typename std::remove_cv<typename std::remove_pointer<P>::type>::type, T>::value>
+    {
+    };
+
+    template<typename Iterateur> static Iterateur lireBloc(Iterateur, int, T *, std::false_type);
+    template<typename Iterateur> static Iterateur lireBloc(Iterateur, int, T *, std::true_type);
+    template<typename Sortie> static Sortie ecrireBloc(T *, int, Sortie, std::false_type);
+    template<typename Sortie> static Sortie ecrireBloc(T *, int, Sortie, std::true_type);
 };
 } //Fin du namespace
 
@@ -41,31 +41,83 @@ File<T>::~File()
     delete[] m_tab;
 }
 
+/**
+ * \brief Constructeur de copie
+ * \param[in] queueToCopy La file à copier
+ * \post La copie a la même capacité et les mêmes éléments, à partir de l'indice 0
+ */
 template<typename T>
-File<T>::File(const File<T> & queueToCopy)
+File<T>::File(const File<T> & queueToCopy): m_tab{nullptr},
+                                            m_tete{0},
+                                            m_queue{0},
+                                            m_tailleMax{0},
+                                            m_cardinalite{0}
 {
-    destruct();
     copy(queueToCopy);
 }
 
+/**
+ * \brief Constructeur de déplacement
+ *
+ * Le tableau est repris tel quel. La source reste vide et sans capacité:
+ * elle ne peut plus qu'être détruite ou réaffectée.
+ *
+ * \param[in] queueToMove La file à déplacer
+ */
+template<typename T>
+File<T>::File(File<T> && queueToMove) noexcept: m_tab{queueToMove.m_tab},
+                                                m_tete{queueToMove.m_tete},
+                                                m_queue{queueToMove.m_queue},
+                                                m_tailleMax{queueToMove.m_tailleMax},
+                                                m_cardinalite{queueToMove.m_cardinalite}
+{
+    queueToMove.m_tab = nullptr;
+    queueToMove.m_tete = 0;
+    queueToMove.m_queue = 0;
+    queueToMove.m_tailleMax = 0;
+    queueToMove.m_cardinalite = 0;
+}
+
 template<typename T>
 void File<T>::destruct()
 {
     delete[] m_tab;
 }
 
+/**
+ * \brief Remplace le contenu par une copie des éléments d'une autre file
+ *
+ * Seuls les m_cardinalite éléments présents sont copiés, en au plus deux
+ * blocs (de la tête à la fin du tableau, puis à partir de l'indice 0), et
+ * rangés à partir de l'indice 0 de la copie. Le nouveau tableau est rempli
+ * avant que l'ancien soit libéré: si une copie d'élément lance une
+ * exception, la file est inchangée.
+ */
 template<typename T>
 void File<T>::copy(const File<T> & queueToCopy)
 {
-    this->m_tete = queueToCopy.m_tete;
-    this->m_queue = queueToCopy.m_queue;
-    this->m_tailleMax = queueToCopy.m_tailleMax;
-    this->m_cardinalite = queueToCopy.m_cardinalite;
-    this->m_tab = new T[queueToCopy.m_tailleMax];
-    for (int i = 0; i < queueToCopy.m_tailleMax; i++)
+    T * tab = new T[queueToCopy.m_tailleMax];
+    try
+    {
+        const int avantRetour = std::min(queueToCopy.m_cardinalite,
+                queueToCopy.m_tailleMax - queueToCopy.m_tete);
+        typename estBlocBrut<const T *>::type brut;
+        lireBloc(static_cast<const T *>(queueToCopy.m_tab + queueToCopy.m_tete), avantRetour, tab, brut);
+        lireBloc(static_cast<const T *>(queueToCopy.m_tab), queueToCopy.m_cardinalite - avantRetour,
+                tab + avantRetour, brut);
+    }
+    catch (...)
     {
-        this->m_tab[i] = queueToCopy.m_tab[i];
+        delete[] tab;
+        throw;
     }
+
+    destruct();
+    this->m_tab = tab;
+    this->m_tete = 0;
+    this->m_tailleMax = queueToCopy.m_tailleMax;
+    this->m_cardinalite = queueToCopy.m_cardinalite;
+    this->m_queue = this->m_cardinalite == this->m_tailleMax ? 0 : this->m_cardinalite;
 }
 
 template<typename T>
@@ -73,16 +125,32 @@ const File<T> &File<T>::operator=(const File<T> & queueToCopy)
 {
     if (this != &queueToCopy)
     {
-        destruct();
         copy(queueToCopy);
     }
     return *this;
 }
 
+/**
+ * \brief Affectation par déplacement
+ *
+ * Les deux files échangent leurs tableaux; l'ancien contenu est libéré
+ * avec la source.
+ */
+template<typename T>
+const File<T> &File<T>::operator=(File<T> && queueToMove) noexcept
+{
+    std::swap(this->m_tab, queueToMove.m_tab);
+    std::swap(this->m_tete, queueToMove.m_tete);
+    std::swap(this->m_queue, queueToMove.m_queue);
+    std::swap(this->m_tailleMax, queueToMove.m_tailleMax);
+    std::swap(this->m_cardinalite, queueToMove.m_cardinalite);
+    return *this;
+}
+
 template<typename T>
 void File<T>::enfiler(const T & newElement)
 {
-    PRECONDITON(this->m_cardinalite < this->m_tailleMax);
+    PRECONDITION(this->m_cardinalite < this->m_tailleMax);
 
     this->m_tab[this->m_queue] = newElement;
     this->m_queue = (this -> m_queue + 1) % this->m_tailleMax;
@@ -108,6 +176,73 @@ T File<T>::defiler()
     return topElement;
 }
 
+/**
+ * \brief Enfile une séquence d'éléments en au plus deux blocs
+ *
+ * Les éléments sont copiés jusqu'à la fin du tableau, puis à partir de
+ * l'indice 0; les indices et la cardinalité ne sont mis à jour qu'une fois.
+ * Pour un T trivialement copiable et une source T*, chaque bloc est un memcpy.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \pre La file a la place pour toute la séquence
+ * \post Les éléments sont à la queue de la file, dans l'ordre
+ */
+template<typename T>
+template<typename Iterateur>
+void File<T>::enfilerN(Iterateur p_debut, Iterateur p_fin)
+{
+    const int nombre = static_cast<int>(std::distance(p_debut, p_fin));
+    PRECONDITION(nombre >= 0);
+    PRECONDITION(nombre <= this->m_tailleMax - this->m_cardinalite);
+
+    if (nombre == 0)
+        return;
+
+    const int avantRetour = std::min(nombre, this->m_tailleMax - this->m_queue);
+    typename estBlocBrut<Iterateur>::type brut;
+    p_debut = lireBloc(p_debut, avantRetour, this->m_tab + this->m_queue, brut);
+    lireBloc(p_debut, nombre - avantRetour, this->m_tab, brut);
+
+    this->m_queue = (this->m_queue + nombre) % this->m_tailleMax;
+    this->m_cardinalite += nombre;
+
+    INVARIANTS();
+}
+
+/**
+ * \brief Défile jusqu'à p_max éléments en au plus deux blocs
+ *
+ * Pour un T trivialement copiable et une destination T*, chaque bloc est
+ * un memcpy; sinon les éléments sont déplacés un à un.
+ *
+ * \param[out] p_sortie Reçoit les éléments défilés, de la tête vers la queue
+ * \param[in] p_max Le nombre maximal d'éléments à défiler
+ * \return Le nombre d'éléments défilés, min(p_max, taille())
+ * \pre p_max >= 0
+ */
+template<typename T>
+template<typename Sortie>
+int File<T>::defilerN(Sortie p_sortie, const int & p_max)
+{
+    PRECONDITION(p_max >= 0);
+
+    const int nombre = std::min(p_max, this->m_cardinalite);
+    if (nombre == 0)
+        return 0;
+
+    const int avantRetour = std::min(nombre, this->m_tailleMax - this->m_tete);
+    typename estBlocBrut<Sortie>::type brut;
+    p_sortie = ecrireBloc(this->m_tab + this->m_tete, avantRetour, p_sortie, brut);
+    ecrireBloc(this->m_tab, nombre - avantRetour, p_sortie, brut);
+
+    this->m_tete = (this->m_tete + nombre) % this->m_tailleMax;
+    this->m_cardinalite -= nombre;
+
+    INVARIANTS();
+    return nombre;
+}
+
 template<typename T>
 int File<T>::taille() const
 {
@@ -145,9 +280,65 @@ template<typename T>
 T File<T>::operator[](const int & index) const
 {
     PRECONDITION(index >= 0);
-    PRECONDITION(index < this->m_tailleMax);
+    PRECONDITION(index < this->m_cardinalite);
+
+    return this->m_tab[(this->m_tete + index) % this->m_tailleMax];
+}
+
+/**
+ * \brief Copie p_nombre éléments d'une source vers le tableau, un à un
+ * \return La source, avancée de p_nombre éléments
+ */
+template<typename T>
+template<typename Iterateur>
+Iterateur File<T>::lireBloc(Iterateur p_source, int p_nombre, T * p_dest, std::false_type)
+{
+    for (int i = 0; i < p_nombre; ++i, ++p_source)
+    {
+        p_dest[i] = *p_source;
+    }
+    return p_source;
+}
+
+/**
+ * \brief Copie p_nombre éléments d'un tableau de T vers le tableau, par memcpy
+ * \return La source, avancée de p_nombre éléments
+ */
+template<typename T>
+template<typename Iterateur>
+Iterateur File<T>::lireBloc(Iterateur p_source, int p_nombre, T * p_dest, std::true_type)
+{
+    if (p_nombre > 0)
+        std::memcpy(p_dest, p_source, p_nombre * sizeof(T));
+    return p_source + p_nombre;
+}
 
-    return this->m_tab[index];
+/**
+ * \brief Déplace p_nombre éléments du tableau vers une sortie, un à un
+ * \return La sortie, avancée de p_nombre éléments
+ */
+template<typename T>
+template<typename Sortie>
+Sortie File<T>::ecrireBloc(T * p_source, int p_nombre, Sortie p_sortie, std::false_type)
+{
+    for (int i = 0; i < p_nombre; ++i, ++p_sortie)
+    {
+        *p_sortie = std::move(p_source[i]);
+    }
+    return p_sortie;
+}
+
+/**
+ * \brief Copie p_nombre éléments du tableau vers un tableau de T, par memcpy
+ * \return La sortie, avancée de p_nombre éléments
+ */
+template<typename T>
+template<typename Sortie>
+Sortie File<T>::ecrireBloc(T * p_source, int p_nombre, Sortie p_sortie, std::true_type)
+{
+    if (p_nombre > 0)
+        std::memcpy(p_sortie, p_source, p_nombre * sizeof(T));
+    return p_sortie + p_nombre;
 }
 
 template<typename T>
@@ -0,0 +1,73 @@
+/**
+ * \file FileAnneau.h
+ * \brief Classe définissant le type abstrait file, dans un anneau extensible
+ * \version 0.1
+ *
+ * Représentation dans un tableau circulaire dont la capacité est une
+ * puissance de 2
+ */
+
+#ifndef _FILEANNEAU_H
+#define _FILEANNEAU_H
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace lab04 {
+/**
+ * \class FileAnneau
+ *
+ * \brief classe générique représentant une File sans capacité maximale
+ *
+ *  Même interface que File, sans estPleine: enfiler ne peut pas échouer.
+ *  La capacité est une puissance de 2, de sorte que le retour au début
+ *  du tableau est un masque de bits plutôt qu'un modulo (une division).
+ *  Quand l'anneau est plein, il est déroulé dans un tableau deux fois
+ *  plus grand: la tête revient à l'indice 0.
+ *
+ *  La représentation est protégée pour FileDouble, qui y ajoute les
+ *  opérations aux deux bouts.
+ */
+template<typename T>
+class FileAnneau
+{
+public:
+	FileAnneau(const int = CAPACITE_INITIALE);
+	~FileAnneau();
+
+	FileAnneau(const FileAnneau<T> &);
+	const FileAnneau<T> & operator =(const FileAnneau<T> &);
+	FileAnneau(FileAnneau<T> &&) noexcept;
+	const FileAnneau<T> & operator =(FileAnneau<T> &&) noexcept;
+
+	void enfiler(const T &);
+	T defiler();
+
+	int taille() const;
+	bool estVide() const;
+	int capacite() const;
+
+	const T & premier() const;
+	const T & dernier() const;
+
+	T operator [](const int &) const;
+
+	void verifieInvariant() const;
+
+protected:
+	T * m_tab; /*!< Tableau circulaire contenant la file, nul après un déplacement*/
+	int m_tete; /*!< Indice du premier élément*/
+	int m_masque; /*!< Capacité moins un; la capacité est une puissance de 2*/
+	int m_cardinalite; /*!< Nombre d'éléments effectifs dans la file*/
+	static const int CAPACITE_INITIALE = 16; /*!< Capacité de la file par défaut*/
+
+	// Méthodes privées
+	void _agrandir();
+	void _copier(const FileAnneau<T> &);
+};
+} //Fin du namespace
+
+#include "FileAnneau.hpp"
+
+#endif
@@ -0,0 +1,291 @@
+#include "ContratException.h"
+#include "PuissanceDe2.h"
+
+namespace lab04 {
+
+/**
+ * \brief Affiche la file, de la tête à la queue
+ */
+template<typename U>
+std::ostream& operator <<(std::ostream& p_out, const FileAnneau<U>& p_source)
+{
+	p_out << "[";
+	for (int i = 0; i < p_source.taille(); ++i)
+	{
+		p_out << p_source[i] << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité initiale, arrondie à la puissance de 2 supérieure
+ * \pre p_capacite > 0
+ * \post La file est vide
+ */
+template<typename T>
+FileAnneau<T>::FileAnneau(const int p_capacite) :
+	m_tab(nullptr), m_tete(0), m_masque(0), m_cardinalite(0)
+{
+	PRECONDITION(p_capacite > 0);
+
+	int capacite = puissanceDe2(p_capacite);
+	m_tab = new T[capacite];
+	m_masque = capacite - 1;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+FileAnneau<T>::~FileAnneau()
+{
+	delete[] m_tab;
+}
+
+/**
+ * \brief Constructeur de copie
+ *
+ * Seuls les éléments présents sont copiés, à partir de l'indice 0.
+ *
+ * \param[in] p_source La file à copier
+ * \post La file contient les mêmes éléments que p_source, dans le même ordre
+ */
+template<typename T>
+FileAnneau<T>::FileAnneau(const FileAnneau<T> & p_source) :
+	m_tab(nullptr), m_tete(0), m_masque(0), m_cardinalite(0)
+{
+	_copier(p_source);
+	INVARIANTS();
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La file à copier
+ * \return La file courante, devenue une copie de p_source
+ */
+template<typename T>
+const FileAnneau<T> & FileAnneau<T>::operator =(const FileAnneau<T> & p_source)
+{
+	if (this != &p_source)
+	{
+		_copier(p_source);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Constructeur de déplacement
+ *
+ * Le tableau est repris tel quel. La source reste vide et sans tableau;
+ * elle en obtiendra un nouveau au prochain ajout.
+ *
+ * \param[in] p_source La file à déplacer
+ */
+template<typename T>
+FileAnneau<T>::FileAnneau(FileAnneau<T> && p_source) noexcept :
+	m_tab(p_source.m_tab), m_tete(p_source.m_tete), m_masque(p_source.m_masque),
+	m_cardinalite(p_source.m_cardinalite)
+{
+	p_source.m_tab = nullptr;
+	p_source.m_tete = 0;
+	p_source.m_masque = -1;
+	p_source.m_cardinalite = 0;
+}
+
+/**
+ * \brief Affectation par déplacement, qui échange les deux tableaux
+ */
+template<typename T>
+const FileAnneau<T> & FileAnneau<T>::operator =(FileAnneau<T> && p_source) noexcept
+{
+	std::swap(m_tab, p_source.m_tab);
+	std::swap(m_tete, p_source.m_tete);
+	std::swap(m_masque, p_source.m_masque);
+	std::swap(m_cardinalite, p_source.m_cardinalite);
+	return *this;
+}
+
+/**
+ * \brief Ajoute un élément à la queue de la file
+ *
+ * Si l'anneau est plein, sa capacité double d'abord.
+ *
+ * \param[in] p_el L'élément à enfiler
+ * \post L'élément est le dernier de la file
+ */
+template<typename T>
+void FileAnneau<T>::enfiler(const T & p_el)
+{
+	if (m_cardinalite > m_masque)
+	{
+		_agrandir();
+	}
+	m_tab[(m_tete + m_cardinalite) & m_masque] = p_el;
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément à la tête de la file
+ * \return L'élément retiré
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+T FileAnneau<T>::defiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	T el(std::move(m_tab[m_tete]));
+	m_tete = (m_tete + 1) & m_masque;
+	--m_cardinalite;
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int FileAnneau<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileAnneau<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne la capacité courante de l'anneau
+ */
+template<typename T>
+int FileAnneau<T>::capacite() const
+{
+	return m_masque + 1;
+}
+
+/**
+ * \brief Retourne l'élément à la tête de la file
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+const T & FileAnneau<T>::premier() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_tab[m_tete];
+}
+
+/**
+ * \brief Retourne l'élément à la queue de la file
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+const T & FileAnneau<T>::dernier() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_tab[(m_tete + m_cardinalite - 1) & m_masque];
+}
+
+/**
+ * \brief Retourne l'élément à une position donnée, 0 étant la tête
+ * \param[in] p_index La position
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+T FileAnneau<T>::operator [](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	return m_tab[(m_tete + p_index) & m_masque];
+}
+
+/**
+ * \brief Vérifie la cohérence de la capacité, de la tête et de la cardinalité
+ */
+template<typename T>
+void FileAnneau<T>::verifieInvariant() const
+{
+	INVARIANT(m_tab == nullptr ? m_masque == -1 : m_masque >= 0 && (m_masque & (m_masque + 1)) == 0);
+	INVARIANT(m_tete >= 0 && (m_tab == nullptr || m_tete <= m_masque));
+	INVARIANT(m_cardinalite >= 0 && m_cardinalite <= m_masque + 1);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Déroule l'anneau dans un tableau deux fois plus grand
+ *
+ * Une file déplacée, sans tableau, repart de la capacité initiale.
+ *
+ * \post La tête est à l'indice 0 et la capacité a doublé
+ */
+template<typename T>
+void FileAnneau<T>::_agrandir()
+{
+	int capacite = m_tab == nullptr ? CAPACITE_INITIALE : (m_masque + 1) * 2;
+	T * nouveau = new T[capacite];
+	try
+	{
+		for (int i = 0; i < m_cardinalite; ++i)
+		{
+			nouveau[i] = std::move(m_tab[(m_tete + i) & m_masque]);
+		}
+	}
+	catch (...)
+	{
+		delete[] nouveau;
+		throw;
+	}
+	delete[] m_tab;
+	m_tab = nouveau;
+	m_tete = 0;
+	m_masque = capacite - 1;
+}
+
+/**
+ * \brief Copie les éléments présents d'une autre file, à partir de l'indice 0
+ *
+ * Le nouveau tableau est rempli avant que l'ancien soit libéré.
+ *
+ * \param[in] p_source La file à copier
+ */
+template<typename T>
+void FileAnneau<T>::_copier(const FileAnneau<T> & p_source)
+{
+	int capacite = p_source.m_tab == nullptr ? CAPACITE_INITIALE : p_source.m_masque + 1;
+	T * nouveau = new T[capacite];
+	try
+	{
+		for (int i = 0; i < p_source.m_cardinalite; ++i)
+		{
+			nouveau[i] = p_source.m_tab[(p_source.m_tete + i) & p_source.m_masque];
+		}
+	}
+	catch (...)
+	{
+		delete[] nouveau;
+		throw;
+	}
+	delete[] m_tab;
+	m_tab = nouveau;
+	m_tete = 0;
+	m_masque = capacite - 1;
+	m_cardinalite = p_source.m_cardinalite;
+}
+
+} //Fin du namespace
@@ -0,0 +1,85 @@
+/**
+ * \file FileBloquante.h
+ * \brief Classe définissant une file bornée où producteurs et consommateurs attendent
+ * \version 0.1
+ *
+ * Enveloppe une File protégée par un mutex. Un consommateur qui trouve la
+ * file vide et un producteur qui la trouve pleine attendent sur une
+ * variable de condition au lieu de sonder; fermer() réveille tout le monde.
+ */
+
+#ifndef _FILEBLOQUANTE_H
+#define _FILEBLOQUANTE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "File.h"
+
+namespace lab04 {
+/**
+ * \class FileBloquante
+ *
+ * \brief classe générique représentant une File bornée bloquante
+ *
+ *  enfiler bloque tant que la file est pleine (contre-pression) et defiler
+ *  tant qu'elle est vide; les deux ont une variante avec délai maximal.
+ *  Après fermer(), enfiler échoue immédiatement et defiler vide ce qui
+ *  reste, puis échoue.
+ *
+ *  Si toursActifs > 0, un fil qui devrait attendre sonde d'abord la file
+ *  ce nombre de fois (en cédant le processeur entre deux sondages) avant
+ *  de s'endormir: une attente brève évite ainsi le coût d'un réveil.
+ */
+template<typename T>
+class FileBloquante
+{
+public:
+	explicit FileBloquante(const int = CAPACITE_DEFAUT, const int = 0);
+
+	bool enfiler(const T &);
+	template<typename Rep, typename Period>
+	bool enfiler(const T &, const std::chrono::duration<Rep, Period> &);
+	bool defiler(T &);
+	template<typename Rep, typename Period>
+	bool defiler(T &, const std::chrono::duration<Rep, Period> &);
+
+	void fermer();
+	bool estFermee() const;
+
+	int taille() const;
+	bool estVide() const;
+
+private:
+	FileBloquante(const FileBloquante<T> &);
+	const FileBloquante<T> & operator =(const FileBloquante<T> &);
+
+	typedef std::unique_lock<std::mutex> verrou;
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité de la file par défaut*/
+
+	mutable std::mutex m_mutex; /*!< Protège m_file et les compteurs d'attente*/
+	std::condition_variable m_nonVide; /*!< Signalée quand un élément est enfilé*/
+	std::condition_variable m_nonPleine; /*!< Signalée quand un élément est défilé*/
+	File<T> m_file; /*!< La file protégée*/
+	const int m_capacite; /*!< Capacité de m_file*/
+	const int m_toursActifs; /*!< Sondages avant de s'endormir*/
+	int m_consommateursEndormis; /*!< Consommateurs qui attendent sur m_nonVide*/
+	int m_producteursEndormis; /*!< Producteurs qui attendent sur m_nonPleine*/
+	std::atomic<int> m_cardinalite; /*!< Copie de m_file.taille(), lisible sans verrou*/
+	std::atomic<bool> m_fermee; /*!< Vrai après fermer()*/
+
+	// Méthodes privées
+	bool _peutEnfiler() const;
+	bool _peutDefiler() const;
+	template<typename Condition> void _sonder(Condition) const;
+	void _enfiler(verrou &, const T &);
+	void _defiler(verrou &, T &);
+};
+} //Fin du namespace
+
+#include "FileBloquante.hpp"
+
+#endif
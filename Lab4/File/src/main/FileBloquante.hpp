@@ -0,0 +1,207 @@
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide et ouverte
+ * \param[in] p_capacite La capacité de la file
+ * \param[in] p_toursActifs Le nombre de sondages avant de s'endormir
+ * \pre p_capacite > 0 et p_toursActifs >= 0
+ */
+template<typename T>
+FileBloquante<T>::FileBloquante(const int p_capacite, const int p_toursActifs) :
+	m_file(p_capacite), m_capacite(p_capacite), m_toursActifs(p_toursActifs),
+	m_consommateursEndormis(0), m_producteursEndormis(0), m_cardinalite(0), m_fermee(false)
+{
+	PRECONDITION(p_capacite > 0);
+	PRECONDITION(p_toursActifs >= 0);
+}
+
+/**
+ * \brief Enfile un élément, en attendant qu'une place se libère
+ * \param[in] p_el L'élément à enfiler
+ * \return false si la file est fermée
+ */
+template<typename T>
+bool FileBloquante<T>::enfiler(const T & p_el)
+{
+	_sonder([this]() { return _peutEnfiler(); });
+	verrou v(m_mutex);
+	++m_producteursEndormis;
+	m_nonPleine.wait(v, [this]() { return _peutEnfiler(); });
+	--m_producteursEndormis;
+	if (m_fermee.load())
+		return false;
+	_enfiler(v, p_el);
+	return true;
+}
+
+/**
+ * \brief Enfile un élément, en attendant au plus un délai qu'une place se libère
+ * \param[in] p_el L'élément à enfiler
+ * \param[in] p_delai Le délai maximal d'attente
+ * \return false si la file est fermée ou est restée pleine pendant tout le délai
+ */
+template<typename T>
+template<typename Rep, typename Period>
+bool FileBloquante<T>::enfiler(const T & p_el, const std::chrono::duration<Rep, Period> & p_delai)
+{
+	_sonder([this]() { return _peutEnfiler(); });
+	verrou v(m_mutex);
+	++m_producteursEndormis;
+	bool pret = m_nonPleine.wait_for(v, p_delai, [this]() { return _peutEnfiler(); });
+	--m_producteursEndormis;
+	if (!pret || m_fermee.load())
+		return false;
+	_enfiler(v, p_el);
+	return true;
+}
+
+/**
+ * \brief Défile un élément, en attendant qu'il y en ait un
+ * \param[out] p_el Reçoit l'élément défilé
+ * \return false si la file est fermée et vide
+ */
+template<typename T>
+bool FileBloquante<T>::defiler(T & p_el)
+{
+	_sonder([this]() { return _peutDefiler(); });
+	verrou v(m_mutex);
+	++m_consommateursEndormis;
+	m_nonVide.wait(v, [this]() { return _peutDefiler(); });
+	--m_consommateursEndormis;
+	if (m_file.estVide())
+		return false;
+	_defiler(v, p_el);
+	return true;
+}
+
+/**
+ * \brief Défile un élément, en attendant au plus un délai qu'il y en ait un
+ * \param[out] p_el Reçoit l'élément défilé
+ * \param[in] p_delai Le délai maximal d'attente
+ * \return false si la file est restée vide pendant tout le délai, ou est fermée et vide
+ */
+template<typename T>
+template<typename Rep, typename Period>
+bool FileBloquante<T>::defiler(T & p_el, const std::chrono::duration<Rep, Period> & p_delai)
+{
+	_sonder([this]() { return _peutDefiler(); });
+	verrou v(m_mutex);
+	++m_consommateursEndormis;
+	m_nonVide.wait_for(v, p_delai, [this]() { return _peutDefiler(); });
+	--m_consommateursEndormis;
+	if (m_file.estVide())
+		return false;
+	_defiler(v, p_el);
+	return true;
+}
+
+/**
+ * \brief Ferme la file et réveille tous les fils qui attendent
+ * \post enfiler échoue; defiler échoue dès que la file est vide
+ */
+template<typename T>
+void FileBloquante<T>::fermer()
+{
+	{
+		verrou v(m_mutex);
+		m_fermee.store(true);
+	}
+	m_nonVide.notify_all();
+	m_nonPleine.notify_all();
+}
+
+/**
+ * \brief Vérifie si la file a été fermée
+ */
+template<typename T>
+bool FileBloquante<T>::estFermee() const
+{
+	return m_fermee.load();
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Sous accès concurrent, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int FileBloquante<T>::taille() const
+{
+	return m_cardinalite.load();
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileBloquante<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+// Méthodes privées
+
+/**
+ * \brief Vrai si un producteur n'a plus à attendre: place libre ou file fermée
+ */
+template<typename T>
+bool FileBloquante<T>::_peutEnfiler() const
+{
+	return m_cardinalite.load() < m_capacite || m_fermee.load();
+}
+
+/**
+ * \brief Vrai si un consommateur n'a plus à attendre: élément présent ou file fermée
+ */
+template<typename T>
+bool FileBloquante<T>::_peutDefiler() const
+{
+	return m_cardinalite.load() > 0 || m_fermee.load();
+}
+
+/**
+ * \brief Sonde une condition sans verrou, au plus m_toursActifs fois
+ *
+ * Le résultat n'est qu'un indice: l'appelant revérifie sous le verrou.
+ */
+template<typename T>
+template<typename Condition>
+void FileBloquante<T>::_sonder(Condition p_condition) const
+{
+	for (int i = 0; i < m_toursActifs && !p_condition(); ++i)
+	{
+		std::this_thread::yield();
+	}
+}
+
+/**
+ * \brief Enfile sous le verrou et réveille un consommateur s'il y en a un qui dort
+ * \pre v détient m_mutex et la file n'est pas pleine
+ */
+template<typename T>
+void FileBloquante<T>::_enfiler(verrou & v, const T & p_el)
+{
+	m_file.enfiler(p_el);
+	m_cardinalite.store(m_file.taille());
+	bool reveiller = m_consommateursEndormis > 0;
+	v.unlock();
+	if (reveiller)
+		m_nonVide.notify_one();
+}
+
+/**
+ * \brief Défile sous le verrou et réveille un producteur s'il y en a un qui dort
+ * \pre v détient m_mutex et la file n'est pas vide
+ */
+template<typename T>
+void FileBloquante<T>::_defiler(verrou & v, T & p_el)
+{
+	p_el = m_file.defiler();
+	m_cardinalite.store(m_file.taille());
+	bool reveiller = m_producteursEndormis > 0;
+	v.unlock();
+	if (reveiller)
+		m_nonPleine.notify_one();
+}
+
+} //Fin du namespace
@@ -0,0 +1,95 @@
+/**
+ * \file FileDePriorite.h
+ * \brief Classe définissant le type abstrait file de priorité
+ * \version 0.1
+ *
+ * Représentation dans un monceau 4-aire implicite (un tableau): les quatre
+ * enfants de la case i sont aux cases 4i + 1 à 4i + 4, ce qui réduit la
+ * hauteur de moitié par rapport à un monceau binaire et garde les enfants
+ * d'un noeud sur la même ligne de cache.
+ */
+
+#ifndef _FILEDEPRIORITE_H
+#define _FILEDEPRIORITE_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace lab04 {
+/**
+ * \class FileDePriorite
+ *
+ * \brief classe générique représentant une file de priorité
+ *
+ *  Même vocabulaire que File: enfiler, defiler, premier, taille, estVide.
+ *  defiler retire l'élément le plus prioritaire, c'est-à-dire le plus
+ *  petit selon Comparateur. enfiler et defiler sont en O(log n), premier
+ *  en O(1), et la construction à partir d'une séquence en O(n).
+ *
+ *  enfiler retourne une poignée qui désigne l'élément tant qu'il est dans
+ *  la file; diminuerCle s'en sert pour rendre un élément plus prioritaire
+ *  en O(log n), grâce à un index des positions dans le monceau.
+ */
+template<typename T, typename Comparateur = std::less<T> >
+class FileDePriorite
+{
+public:
+	typedef int Poignee; /*!< Désigne un élément présent dans la file*/
+
+	explicit FileDePriorite(const Comparateur & = Comparateur());
+	template<typename Iterateur>
+	FileDePriorite(Iterateur, Iterateur, const Comparateur & = Comparateur());
+
+	Poignee enfiler(const T &);
+	T defiler();
+	void diminuerCle(const Poignee &, const T &);
+
+	int taille() const;
+	bool estVide() const;
+	bool contient(const Poignee &) const;
+
+	const T & premier() const;
+	const T & element(const Poignee &) const;
+
+	void verifieInvariant() const;
+
+private:
+	/**
+	 * \class Entree
+	 *
+	 * \brief Classe interne représentant une case du monceau.
+	 */
+	class Entree
+	{
+	public:
+		T m_el; /*!< L'élément*/
+		Poignee m_poignee; /*!< La poignée de l'élément*/
+
+		Entree(const T & el, Poignee poignee) :
+			m_el(el), m_poignee(poignee)
+		{
+		}
+	};
+
+	static const int ARITE = 4; /*!< Nombre d'enfants par noeud*/
+
+	std::vector<Entree> m_tas; /*!< Le monceau, le plus prioritaire à l'indice 0*/
+	std::vector<int> m_positions; /*!< Indice dans m_tas de chaque poignée, -1 si absente*/
+	std::vector<Poignee> m_poigneesLibres; /*!< Poignées à réutiliser*/
+	Comparateur m_comparateur; /*!< Ordre de priorité*/
+
+	// Méthodes privées
+	Poignee _nouvellePoignee();
+	void _monter(int);
+	void _descendre(int);
+	void _placer(Entree &&, int);
+};
+} //Fin du namespace
+
+#include "FileDePriorite.hpp"
+
+#endif
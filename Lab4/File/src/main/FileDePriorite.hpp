@@ -0,0 +1,253 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_comparateur L'ordre de priorité
+ * \post La file est vide
+ */
+template<typename T, typename Comparateur>
+FileDePriorite<T, Comparateur>::FileDePriorite(const Comparateur & p_comparateur) :
+	m_comparateur(p_comparateur)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur à partir d'une séquence, en O(n)
+ *
+ * Les éléments sont placés tels quels, puis le monceau est construit de
+ * bas en haut (méthode de Floyd). Le i-ème élément de la séquence reçoit
+ * la poignée i.
+ *
+ * \param[in] p_debut Le début de la séquence
+ * \param[in] p_fin La fin (exclue) de la séquence
+ * \param[in] p_comparateur L'ordre de priorité
+ * \post La file contient les éléments de la séquence
+ */
+template<typename T, typename Comparateur>
+template<typename Iterateur>
+FileDePriorite<T, Comparateur>::FileDePriorite(Iterateur p_debut, Iterateur p_fin,
+		const Comparateur & p_comparateur) :
+	m_comparateur(p_comparateur)
+{
+	for (; p_debut != p_fin; ++p_debut)
+	{
+		m_positions.push_back(static_cast<int>(m_tas.size()));
+		m_tas.push_back(Entree(*p_debut, static_cast<Poignee>(m_tas.size())));
+	}
+	for (int i = (static_cast<int>(m_tas.size()) - 2) / ARITE; i >= 0; --i)
+	{
+		_descendre(i);
+	}
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute un élément
+ * \param[in] p_el L'élément à enfiler
+ * \return La poignée de l'élément, valide jusqu'à ce qu'il soit défilé
+ */
+template<typename T, typename Comparateur>
+typename FileDePriorite<T, Comparateur>::Poignee FileDePriorite<T, Comparateur>::enfiler(const T & p_el)
+{
+	Poignee poignee = _nouvellePoignee();
+	m_tas.push_back(Entree(p_el, poignee));
+	m_positions[poignee] = static_cast<int>(m_tas.size()) - 1;
+	_monter(static_cast<int>(m_tas.size()) - 1);
+
+	INVARIANTS();
+	return poignee;
+}
+
+/**
+ * \brief Retire l'élément le plus prioritaire
+ * \return L'élément retiré
+ * \pre La file n'est pas vide
+ */
+template<typename T, typename Comparateur>
+T FileDePriorite<T, Comparateur>::defiler()
+{
+	PRECONDITION(!m_tas.empty());
+
+	T el(std::move(m_tas.front().m_el));
+	Poignee poignee = m_tas.front().m_poignee;
+	m_positions[poignee] = -1;
+	m_poigneesLibres.push_back(poignee);
+
+	if (m_tas.size() > 1)
+	{
+		_placer(std::move(m_tas.back()), 0);
+		m_tas.pop_back();
+		_descendre(0);
+	}
+	else
+	{
+		m_tas.pop_back();
+	}
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Rend un élément plus prioritaire en remplaçant sa valeur
+ * \param[in] p_poignee La poignée de l'élément
+ * \param[in] p_el La nouvelle valeur
+ * \pre L'élément est dans la file et p_el n'est pas moins prioritaire que l'ancienne valeur
+ */
+template<typename T, typename Comparateur>
+void FileDePriorite<T, Comparateur>::diminuerCle(const Poignee & p_poignee, const T & p_el)
+{
+	PRECONDITION(contient(p_poignee));
+	PRECONDITION(!m_comparateur(m_tas[m_positions[p_poignee]].m_el, p_el));
+
+	int position = m_positions[p_poignee];
+	m_tas[position].m_el = p_el;
+	_monter(position);
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T, typename Comparateur>
+int FileDePriorite<T, Comparateur>::taille() const
+{
+	return static_cast<int>(m_tas.size());
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T, typename Comparateur>
+bool FileDePriorite<T, Comparateur>::estVide() const
+{
+	return m_tas.empty();
+}
+
+/**
+ * \brief Vérifie si une poignée désigne un élément présent dans la file
+ */
+template<typename T, typename Comparateur>
+bool FileDePriorite<T, Comparateur>::contient(const Poignee & p_poignee) const
+{
+	return p_poignee >= 0 && p_poignee < static_cast<int>(m_positions.size())
+			&& m_positions[p_poignee] >= 0;
+}
+
+/**
+ * \brief Retourne l'élément le plus prioritaire
+ * \pre La file n'est pas vide
+ */
+template<typename T, typename Comparateur>
+const T & FileDePriorite<T, Comparateur>::premier() const
+{
+	PRECONDITION(!m_tas.empty());
+
+	return m_tas.front().m_el;
+}
+
+/**
+ * \brief Retourne l'élément désigné par une poignée
+ * \pre L'élément est dans la file
+ */
+template<typename T, typename Comparateur>
+const T & FileDePriorite<T, Comparateur>::element(const Poignee & p_poignee) const
+{
+	PRECONDITION(contient(p_poignee));
+
+	return m_tas[m_positions[p_poignee]].m_el;
+}
+
+/**
+ * \brief Vérifie la cohérence entre le monceau et l'index des positions
+ */
+template<typename T, typename Comparateur>
+void FileDePriorite<T, Comparateur>::verifieInvariant() const
+{
+	INVARIANT(m_tas.size() + m_poigneesLibres.size() == m_positions.size());
+	INVARIANT(m_tas.empty() || m_positions[m_tas.front().m_poignee] == 0);
+	INVARIANT(m_tas.empty() || m_positions[m_tas.back().m_poignee] == static_cast<int>(m_tas.size()) - 1);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne une poignée libre, réutilisée si possible
+ */
+template<typename T, typename Comparateur>
+typename FileDePriorite<T, Comparateur>::Poignee FileDePriorite<T, Comparateur>::_nouvellePoignee()
+{
+	if (!m_poigneesLibres.empty())
+	{
+		Poignee poignee = m_poigneesLibres.back();
+		m_poigneesLibres.pop_back();
+		return poignee;
+	}
+	m_positions.push_back(-1);
+	return static_cast<Poignee>(m_positions.size()) - 1;
+}
+
+/**
+ * \brief Fait remonter une case tant qu'elle est plus prioritaire que son parent
+ *
+ * L'entrée est retenue à part et les parents descendent dans le trou:
+ * une seule écriture par niveau au lieu d'un échange.
+ */
+template<typename T, typename Comparateur>
+void FileDePriorite<T, Comparateur>::_monter(int p_position)
+{
+	Entree montee(std::move(m_tas[p_position]));
+	while (p_position > 0)
+	{
+		int parent = (p_position - 1) / ARITE;
+		if (!m_comparateur(montee.m_el, m_tas[parent].m_el))
+			break;
+		_placer(std::move(m_tas[parent]), p_position);
+		p_position = parent;
+	}
+	_placer(std::move(montee), p_position);
+}
+
+/**
+ * \brief Fait descendre une case tant qu'un de ses enfants est plus prioritaire
+ */
+template<typename T, typename Comparateur>
+void FileDePriorite<T, Comparateur>::_descendre(int p_position)
+{
+	const int taille = static_cast<int>(m_tas.size());
+	Entree descendue(std::move(m_tas[p_position]));
+	for (;;)
+	{
+		int premierEnfant = ARITE * p_position + 1;
+		if (premierEnfant >= taille)
+			break;
+		int dernierEnfant = std::min(premierEnfant + ARITE, taille);
+		int meilleur = premierEnfant;
+		for (int enfant = premierEnfant + 1; enfant < dernierEnfant; ++enfant)
+		{
+			if (m_comparateur(m_tas[enfant].m_el, m_tas[meilleur].m_el))
+				meilleur = enfant;
+		}
+		if (!m_comparateur(m_tas[meilleur].m_el, descendue.m_el))
+			break;
+		_placer(std::move(m_tas[meilleur]), p_position);
+		p_position = meilleur;
+	}
+	_placer(std::move(descendue), p_position);
+}
+
+/**
+ * \brief Range une entrée dans une case et met à jour l'index des positions
+ */
+template<typename T, typename Comparateur>
+void FileDePriorite<T, Comparateur>::_placer(Entree && p_entree, int p_position)
+{
+	m_positions[p_entree.m_poignee] = p_position;
+	m_tas[p_position] = std::move(p_entree);
+}
+
+} //Fin du namespace
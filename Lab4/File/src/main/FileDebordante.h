@@ -0,0 +1,97 @@
+/**
+ * \file FileDebordante.h
+ * \brief Classe définissant une file qui déborde sur disque
+ * \version 0.1
+ *
+ * Une File bornée garde en mémoire les éléments les plus anciens. Quand
+ * elle est pleine, les nouveaux éléments s'accumulent dans un tampon
+ * d'écriture qui, une fois plein, est écrit d'un bloc dans un fichier de
+ * segment. Les segments sont relus dans l'ordre, un bloc à la fois, quand
+ * la partie en mémoire se vide, puis effacés. Toutes les entrées-sorties
+ * sont donc séquentielles et par segments entiers.
+ */
+
+#ifndef _FILEDEBORDANTE_H
+#define _FILEDEBORDANTE_H
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "File.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace lab04 {
+/**
+ * \class FileDebordante
+ *
+ * \brief classe générique représentant une File non bornée qui déborde sur disque
+ *
+ *  L'ordre FIFO est conservé à travers les trois zones: la File en
+ *  mémoire (les plus anciens), les segments sur disque, puis le tampon
+ *  d'écriture (les plus récents). Un élément n'est écrit sur disque que si
+ *  la mémoire est pleine; en régime normal la file se comporte comme File.
+ *
+ *  Les éléments sont écrits octet par octet: T doit être trivialement
+ *  copiable. Avec SYNCHRO_PAR_SEGMENT, chaque segment est forcé sur le
+ *  disque (fsync) avant que enfiler retourne. Une erreur d'entrée-sortie
+ *  lance std::runtime_error.
+ */
+template<typename T>
+class FileDebordante
+{
+public:
+	enum Synchronisation
+	{
+		SANS_SYNCHRO, /*!< Le système écrit les segments quand il le juge bon*/
+		SYNCHRO_PAR_SEGMENT /*!< Chaque segment est forcé sur le disque*/
+	};
+
+	explicit FileDebordante(const std::string &, const int = CAPACITE_DEFAUT,
+			const int = TAILLE_SEGMENT_DEFAUT, const Synchronisation = SANS_SYNCHRO);
+	~FileDebordante();
+
+	void enfiler(const T &);
+	T defiler();
+
+	int taille() const;
+	bool estVide() const;
+	int nombreSegments() const;
+
+	void verifieInvariant() const;
+
+private:
+	FileDebordante(const FileDebordante<T> &);
+	const FileDebordante<T> & operator =(const FileDebordante<T> &);
+
+	static_assert(std::is_trivially_copyable<T>::value,
+			"FileDebordante écrit ses éléments tels quels sur disque");
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité en mémoire par défaut*/
+	static const int TAILLE_SEGMENT_DEFAUT = 256; /*!< Éléments par segment par défaut*/
+
+	File<T> m_memoire; /*!< Les éléments les plus anciens*/
+	std::vector<T> m_tampon; /*!< Les éléments les plus récents, pas encore écrits*/
+	std::vector<T> m_lecture; /*!< Reçoit un segment relu*/
+	const std::string m_prefixe; /*!< Préfixe des noms de fichiers de segment*/
+	const int m_capacite; /*!< Capacité de m_memoire*/
+	const int m_tailleSegment; /*!< Nombre d'éléments par segment*/
+	const Synchronisation m_synchronisation; /*!< Politique de synchronisation*/
+	long long m_premierSegment; /*!< Numéro du plus ancien segment sur disque*/
+	long long m_prochainSegment; /*!< Numéro du prochain segment à écrire*/
+
+	// Méthodes privées
+	std::string _nomSegment(long long) const;
+	void _deverser();
+	void _recharger();
+};
+} //Fin du namespace
+
+#include "FileDebordante.hpp"
+
+#endif
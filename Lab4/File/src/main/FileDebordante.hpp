@@ -0,0 +1,218 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_prefixe Préfixe (chemin compris) des fichiers de segment
+ * \param[in] p_capacite Le nombre d'éléments gardés en mémoire
+ * \param[in] p_tailleSegment Le nombre d'éléments par segment
+ * \param[in] p_synchronisation La politique de synchronisation des segments
+ * \pre 0 < p_tailleSegment < p_capacite
+ *
+ * La borne stricte laisse à la mémoire, quand il ne lui reste qu'un
+ * élément, la place de recharger un segment entier avant de le défiler.
+ */
+template<typename T>
+FileDebordante<T>::FileDebordante(const std::string & p_prefixe, const int p_capacite,
+		const int p_tailleSegment, const Synchronisation p_synchronisation) :
+	m_memoire(p_capacite), m_prefixe(p_prefixe), m_capacite(p_capacite),
+	m_tailleSegment(p_tailleSegment), m_synchronisation(p_synchronisation),
+	m_premierSegment(0), m_prochainSegment(0)
+{
+	PRECONDITION(p_tailleSegment > 0);
+	PRECONDITION(p_tailleSegment < p_capacite);
+
+	m_tampon.reserve(p_tailleSegment);
+	m_lecture.resize(p_tailleSegment);
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur, efface les segments qui n'ont pas été relus
+ */
+template<typename T>
+FileDebordante<T>::~FileDebordante()
+{
+	for (long long i = m_premierSegment; i < m_prochainSegment; ++i)
+	{
+		std::remove(_nomSegment(i).c_str());
+	}
+}
+
+/**
+ * \brief Enfile un élément
+ *
+ * Il va en mémoire s'il y a de la place et que rien n'attend sur disque
+ * ou dans le tampon; sinon il va dans le tampon d'écriture, qui est écrit
+ * comme nouveau segment dès qu'il est plein.
+ *
+ * Si l'écriture du segment échoue, l'élément est retiré du tampon avant
+ * que l'exception soit relancée: la file est inchangée.
+ *
+ * \param[in] p_el L'élément à enfiler
+ */
+template<typename T>
+void FileDebordante<T>::enfiler(const T & p_el)
+{
+	if (m_premierSegment == m_prochainSegment && m_tampon.empty() && !m_memoire.estPleine())
+	{
+		m_memoire.enfiler(p_el);
+	}
+	else
+	{
+		m_tampon.push_back(p_el);
+		if (static_cast<int>(m_tampon.size()) == m_tailleSegment)
+		{
+			try
+			{
+				_deverser();
+			}
+			catch (...)
+			{
+				m_tampon.pop_back();
+				throw;
+			}
+		}
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Défile l'élément le plus ancien
+ *
+ * Avant de retirer le dernier élément en mémoire, la mémoire est
+ * rechargée depuis les segments, ou depuis le tampon d'écriture s'il n'y
+ * a plus de segments: elle n'est vide que si toute la file l'est. Si la
+ * relecture d'un segment échoue, rien n'a été défilé.
+ *
+ * \return L'élément défilé
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+T FileDebordante<T>::defiler()
+{
+	PRECONDITION(!estVide());
+
+	if (m_memoire.taille() == 1)
+		_recharger();
+	T el = m_memoire.defiler();
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments, en mémoire et sur disque
+ */
+template<typename T>
+int FileDebordante<T>::taille() const
+{
+	return m_memoire.taille() + static_cast<int>(m_prochainSegment - m_premierSegment) * m_tailleSegment
+			+ static_cast<int>(m_tampon.size());
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileDebordante<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Retourne le nombre de segments présentement sur disque
+ */
+template<typename T>
+int FileDebordante<T>::nombreSegments() const
+{
+	return static_cast<int>(m_prochainSegment - m_premierSegment);
+}
+
+/**
+ * \brief Vérifie que les zones respectent l'ordre de remplissage
+ */
+template<typename T>
+void FileDebordante<T>::verifieInvariant() const
+{
+	INVARIANT(m_premierSegment <= m_prochainSegment);
+	INVARIANT(static_cast<int>(m_tampon.size()) < m_tailleSegment);
+	INVARIANT((m_premierSegment == m_prochainSegment && m_tampon.empty()) || !m_memoire.estVide());
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne le nom du fichier d'un segment
+ */
+template<typename T>
+std::string FileDebordante<T>::_nomSegment(long long p_numero) const
+{
+	return m_prefixe + "." + std::to_string(p_numero);
+}
+
+/**
+ * \brief Écrit le tampon d'écriture, plein, dans un nouveau segment
+ */
+template<typename T>
+void FileDebordante<T>::_deverser()
+{
+	const std::string nom = _nomSegment(m_prochainSegment);
+	std::FILE * fichier = std::fopen(nom.c_str(), "wb");
+	if (fichier == 0)
+		throw std::runtime_error("FileDebordante: impossible de créer " + nom);
+
+	bool ok = std::fwrite(m_tampon.data(), sizeof(T), m_tampon.size(), fichier) == m_tampon.size();
+	ok = std::fflush(fichier) == 0 && ok;
+#if defined(__unix__) || defined(__APPLE__)
+	if (m_synchronisation == SYNCHRO_PAR_SEGMENT)
+		ok = fsync(fileno(fichier)) == 0 && ok;
+#endif
+	ok = std::fclose(fichier) == 0 && ok;
+	if (!ok)
+	{
+		std::remove(nom.c_str());
+		throw std::runtime_error("FileDebordante: écriture incomplète de " + nom);
+	}
+
+	++m_prochainSegment;
+	m_tampon.clear();
+}
+
+/**
+ * \brief Remplit la mémoire depuis les segments, dans l'ordre
+ *
+ * Des segments entiers sont relus tant qu'il en reste et qu'ils tiennent
+ * en mémoire. Quand il n'y en a plus, le tampon d'écriture les suit.
+ */
+template<typename T>
+void FileDebordante<T>::_recharger()
+{
+	while (m_premierSegment < m_prochainSegment && m_capacite - m_memoire.taille() >= m_tailleSegment)
+	{
+		const std::string nom = _nomSegment(m_premierSegment);
+		std::FILE * fichier = std::fopen(nom.c_str(), "rb");
+		if (fichier == 0)
+			throw std::runtime_error("FileDebordante: impossible d'ouvrir " + nom);
+		const std::size_t lus = std::fread(m_lecture.data(), sizeof(T), m_lecture.size(), fichier);
+		std::fclose(fichier);
+		if (lus != m_lecture.size())
+			throw std::runtime_error("FileDebordante: segment tronqué " + nom);
+
+		m_memoire.enfilerN(m_lecture.data(), m_lecture.data() + m_tailleSegment);
+		std::remove(nom.c_str());
+		++m_premierSegment;
+	}
+
+	if (m_premierSegment == m_prochainSegment && !m_tampon.empty())
+	{
+		const int nombre = std::min(m_capacite - m_memoire.taille(), static_cast<int>(m_tampon.size()));
+		m_memoire.enfilerN(m_tampon.data(), m_tampon.data() + nombre);
+		m_tampon.erase(m_tampon.begin(), m_tampon.begin() + nombre);
+	}
+}
+
+} //Fin du namespace
@@ -0,0 +1,52 @@
+/**
+ * \file FileDouble.h
+ * \brief Classe définissant une file à double entrée, dans un anneau extensible
+ * \version 0.1
+ *
+ * FileAnneau, avec ajout et retrait aux deux bouts
+ */
+
+#ifndef _FILEDOUBLE_H
+#define _FILEDOUBLE_H
+
+#include "FileAnneau.h"
+
+namespace lab04 {
+/**
+ * \class FileDouble
+ *
+ * \brief classe générique représentant une file à double entrée
+ *
+ *  enfiler et defiler travaillent comme dans File (queue, tête);
+ *  enfilerEnTete et defilerEnQueue font l'inverse. Les quatre sont en
+ *  O(1) amorti: reculer la tête est un masque de bits, comme avancer.
+ *  operator [] compte à partir de la tête, en O(1), et permet de modifier
+ *  un élément en place. L'anneau, sa croissance, la copie et le
+ *  déplacement sont ceux de FileAnneau.
+ */
+template<typename T>
+class FileDouble: public FileAnneau<T>
+{
+public:
+	FileDouble(const int = FileAnneau<T>::CAPACITE_INITIALE);
+
+	void enfilerEnTete(const T &);
+	T defilerEnQueue();
+
+	const T & operator [](const int &) const;
+	T & operator [](const int &);
+
+	using FileAnneau<T>::verifieInvariant;
+
+private:
+	using FileAnneau<T>::m_tab;
+	using FileAnneau<T>::m_tete;
+	using FileAnneau<T>::m_masque;
+	using FileAnneau<T>::m_cardinalite;
+	using FileAnneau<T>::_agrandir;
+};
+} //Fin du namespace
+
+#include "FileDouble.hpp"
+
+#endif
@@ -0,0 +1,85 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité initiale, arrondie à la puissance de 2 supérieure
+ * \pre p_capacite > 0
+ * \post La file est vide
+ */
+template<typename T>
+FileDouble<T>::FileDouble(const int p_capacite) :
+	FileAnneau<T>(p_capacite)
+{
+}
+
+/**
+ * \brief Ajoute un élément à la tête de la file
+ *
+ * Si l'anneau est plein, sa capacité double d'abord. La tête recule d'une
+ * case, en revenant à la fin du tableau au besoin.
+ *
+ * \param[in] p_el L'élément à enfiler
+ * \post L'élément est le premier de la file
+ */
+template<typename T>
+void FileDouble<T>::enfilerEnTete(const T & p_el)
+{
+	if (m_cardinalite > m_masque)
+	{
+		_agrandir();
+	}
+	m_tete = (m_tete - 1) & m_masque;
+	m_tab[m_tete] = p_el;
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément à la queue de la file
+ * \return L'élément retiré
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+T FileDouble<T>::defilerEnQueue()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	--m_cardinalite;
+	T el(std::move(m_tab[(m_tete + m_cardinalite) & m_masque]));
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Retourne l'élément à une position donnée, 0 étant la tête
+ * \param[in] p_index La position
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+const T & FileDouble<T>::operator [](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	return m_tab[(m_tete + p_index) & m_masque];
+}
+
+/**
+ * \brief Accède en écriture à l'élément à une position donnée, 0 étant la tête
+ * \param[in] p_index La position
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+T & FileDouble<T>::operator [](const int & p_index)
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	return m_tab[(m_tete + p_index) & m_masque];
+}
+
+} //Fin du namespace
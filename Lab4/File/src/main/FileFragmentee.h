@@ -0,0 +1,104 @@
+/**
+ * \file FileFragmentee.h
+ * \brief Classe définissant une file partagée répartie en fragments
+ * \version 0.1
+ *
+ * Plusieurs File bornées (les fragments), chacune protégée par son propre
+ * mutex et sur ses propres lignes de cache. Chaque fil reçoit un numéro à
+ * sa première opération; un producteur enfile dans le fragment de son
+ * numéro, de sorte que des producteurs différents se disputent rarement
+ * le même verrou. Un consommateur commence par le fragment de son numéro
+ * puis parcourt les autres à tour de rôle (vol), en sautant ceux dont le
+ * compteur indique qu'ils sont vides, sans prendre leur verrou.
+ */
+
+#ifndef _FILEFRAGMENTEE_H
+#define _FILEFRAGMENTEE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "File.h"
+
+namespace lab04 {
+/**
+ * \class FileFragmentee
+ *
+ * \brief classe générique représentant une File partagée à FIFO relâché
+ *
+ *  enfiler et defiler peuvent être appelés en même temps par n'importe
+ *  quels fils et retournent false plutôt que d'attendre, comme FileMPMC.
+ *  L'ordre FIFO ne vaut qu'à l'intérieur d'un fragment.
+ *
+ *  Avec PAR_PRODUCTEUR, un producteur enfile toujours dans le même
+ *  fragment: ses éléments sont défilés dans l'ordre où il les a enfilés
+ *  (par un même consommateur), et enfiler échoue quand ce fragment est
+ *  plein. Avec LIBRE, un producteur dont le fragment est verrouillé ou
+ *  plein essaie les suivants: la contention baisse encore, mais l'ordre
+ *  par producteur n'est plus garanti.
+ */
+template<typename T>
+class FileFragmentee
+{
+public:
+	enum Affectation
+	{
+		PAR_PRODUCTEUR, /*!< Un fragment fixe par producteur, ordre par producteur conservé*/
+		LIBRE /*!< Un producteur peut passer à un autre fragment*/
+	};
+
+	explicit FileFragmentee(const int = CAPACITE_DEFAUT, const int = 0, const Affectation = PAR_PRODUCTEUR);
+
+	bool enfiler(const T &);
+	bool defiler(T &);
+
+	int taille() const;
+	bool estVide() const;
+	int nombreFragments() const;
+
+private:
+	FileFragmentee(const FileFragmentee<T> &);
+	const FileFragmentee<T> & operator =(const FileFragmentee<T> &);
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité de chaque fragment par défaut*/
+	static const std::size_t TAILLE_LIGNE = 64; /*!< Taille d'une ligne de cache*/
+
+	/**
+	 * \class Fragment
+	 *
+	 * \brief Classe interne représentant un fragment: une File et son verrou.
+	 *
+	 * Le bourrage sépare les fragments voisins du tableau, qui sont
+	 * verrouillés par des fils différents.
+	 */
+	class Fragment
+	{
+	public:
+		std::mutex m_verrou; /*!< Protège m_file*/
+		File<T> m_file; /*!< Les éléments du fragment*/
+		std::atomic<int> m_cardinalite; /*!< Copie de m_file.taille(), lisible sans verrou*/
+		char m_bourrage[TAILLE_LIGNE];
+
+		Fragment() :
+			m_cardinalite(0)
+		{
+		}
+	};
+
+	const std::unique_ptr<Fragment[]> m_fragments; /*!< Les fragments*/
+	const int m_nombreFragments; /*!< Nombre de fragments*/
+	const Affectation m_affectation; /*!< Politique des producteurs*/
+
+	// Méthodes privées
+	bool _enfiler(Fragment &, const T &);
+	bool _defiler(Fragment &, T &);
+	int _fragmentDuFil() const;
+	static int _nombreParDefaut(int);
+};
+} //Fin du namespace
+
+#include "FileFragmentee.hpp"
+
+#endif
@@ -0,0 +1,170 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité de chaque fragment
+ * \param[in] p_nombreFragments Le nombre de fragments, 0 pour un par cœur
+ * \param[in] p_affectation La politique des producteurs
+ * \pre p_capacite > 0 et p_nombreFragments >= 0
+ */
+template<typename T>
+FileFragmentee<T>::FileFragmentee(const int p_capacite, const int p_nombreFragments,
+		const Affectation p_affectation) :
+	m_fragments(new Fragment[_nombreParDefaut(p_nombreFragments)]),
+	m_nombreFragments(_nombreParDefaut(p_nombreFragments)), m_affectation(p_affectation)
+{
+	PRECONDITION(p_capacite > 0);
+
+	for (int i = 0; i < m_nombreFragments; ++i)
+		m_fragments[i].m_file = File<T>(p_capacite);
+}
+
+/**
+ * \brief Enfile un élément dans le fragment du fil appelant
+ *
+ * Avec LIBRE, si ce verrou est déjà pris ou ce fragment plein, les
+ * fragments suivants sont essayés sans attendre, puis le fragment du fil
+ * est attendu en dernier recours.
+ *
+ * \param[in] p_el L'élément à enfiler
+ * \return false si le fragment (avec LIBRE, tous les fragments) est plein
+ */
+template<typename T>
+bool FileFragmentee<T>::enfiler(const T & p_el)
+{
+	const int depart = _fragmentDuFil();
+	if (m_affectation == LIBRE)
+	{
+		for (int i = 0; i < m_nombreFragments; ++i)
+		{
+			Fragment & fragment = m_fragments[(depart + i) % m_nombreFragments];
+			std::unique_lock<std::mutex> verrou(fragment.m_verrou, std::try_to_lock);
+			if (verrou.owns_lock() && _enfiler(fragment, p_el))
+				return true;
+		}
+	}
+
+	Fragment & fragment = m_fragments[depart];
+	std::lock_guard<std::mutex> verrou(fragment.m_verrou);
+	return _enfiler(fragment, p_el);
+}
+
+/**
+ * \brief Défile un élément, du fragment du fil appelant d'abord
+ *
+ * Les autres fragments sont ensuite parcourus à tour de rôle; ceux que
+ * leur compteur dit vides sont sautés sans verrouiller.
+ *
+ * \param[out] p_el Reçoit l'élément défilé
+ * \return false si aucun fragment n'avait d'élément
+ */
+template<typename T>
+bool FileFragmentee<T>::defiler(T & p_el)
+{
+	const int depart = _fragmentDuFil();
+	for (int i = 0; i < m_nombreFragments; ++i)
+	{
+		Fragment & fragment = m_fragments[(depart + i) % m_nombreFragments];
+		if (fragment.m_cardinalite.load(std::memory_order_relaxed) == 0)
+			continue;
+		std::lock_guard<std::mutex> verrou(fragment.m_verrou);
+		if (_defiler(fragment, p_el))
+			return true;
+	}
+	return false;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Somme des compteurs des fragments: sous accès concurrent, un instantané approximatif.
+ */
+template<typename T>
+int FileFragmentee<T>::taille() const
+{
+	int taille = 0;
+	for (int i = 0; i < m_nombreFragments; ++i)
+		taille += m_fragments[i].m_cardinalite.load(std::memory_order_relaxed);
+	return taille;
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileFragmentee<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Retourne le nombre de fragments
+ */
+template<typename T>
+int FileFragmentee<T>::nombreFragments() const
+{
+	return m_nombreFragments;
+}
+
+// Méthodes privées
+
+/**
+ * \brief Enfile dans un fragment dont le verrou est détenu
+ * \return false si le fragment est plein
+ */
+template<typename T>
+bool FileFragmentee<T>::_enfiler(Fragment & p_fragment, const T & p_el)
+{
+	if (p_fragment.m_file.estPleine())
+		return false;
+	p_fragment.m_file.enfiler(p_el);
+	p_fragment.m_cardinalite.store(p_fragment.m_file.taille(), std::memory_order_relaxed);
+	return true;
+}
+
+/**
+ * \brief Défile d'un fragment dont le verrou est détenu
+ * \return false si le fragment est vide
+ */
+template<typename T>
+bool FileFragmentee<T>::_defiler(Fragment & p_fragment, T & p_el)
+{
+	if (p_fragment.m_file.estVide())
+		return false;
+	p_el = p_fragment.m_file.defiler();
+	p_fragment.m_cardinalite.store(p_fragment.m_file.taille(), std::memory_order_relaxed);
+	return true;
+}
+
+/**
+ * \brief Retourne le fragment attribué au fil appelant
+ *
+ * Chaque fil reçoit un numéro séquentiel à son premier appel, ce qui
+ * répartit les fils sur les fragments aussi également que possible.
+ */
+template<typename T>
+int FileFragmentee<T>::_fragmentDuFil() const
+{
+	static std::atomic<unsigned int> prochainNumero(0);
+	static thread_local unsigned int numero = prochainNumero.fetch_add(1, std::memory_order_relaxed);
+	return static_cast<int>(numero % static_cast<unsigned int>(m_nombreFragments));
+}
+
+/**
+ * \brief Retourne p_nombre, ou le nombre de cœurs si p_nombre vaut 0
+ * \pre p_nombre >= 0
+ */
+template<typename T>
+int FileFragmentee<T>::_nombreParDefaut(int p_nombre)
+{
+	PRECONDITION(p_nombre >= 0);
+
+	if (p_nombre > 0)
+		return p_nombre;
+	const unsigned int coeurs = std::thread::hardware_concurrency();
+	return coeurs > 0 ? static_cast<int>(coeurs) : 1;
+}
+
+} //Fin du namespace
@@ -0,0 +1,89 @@
+/**
+ * \file FileInstrumentee.h
+ * \brief Classe définissant une File qui tient ses compteurs d'activité
+ * \version 0.1
+ *
+ * Enveloppe une File dont les éléments sont horodatés à l'enfilement; au
+ * défilement, le temps passé dans la file est versé dans l'histogramme
+ * d'une TelemetrieFile. File elle-même ne paie rien: l'instrumentation
+ * ne coûte que là où on choisit FileInstrumentee.
+ *
+ * Une lecture d'horloge coûte plus cher qu'un enfilement dans File; avec
+ * une période d'échantillonnage N > 1, seul un élément sur N est horodaté
+ * (et mesuré au défilement). Les compteurs restent exacts.
+ */
+
+#ifndef _FILEINSTRUMENTEE_H
+#define _FILEINSTRUMENTEE_H
+
+#include <cstdint>
+#include <utility>
+#include "File.h"
+#include "TelemetrieFile.h"
+
+namespace lab04 {
+/**
+ * \class FileInstrumentee
+ *
+ * \brief classe générique représentant une File instrumentée
+ *
+ *  Même interface que File (sans operator []), plus telemetrie(), que
+ *  n'importe quel autre fil peut consulter pendant que la file travaille.
+ */
+template<typename T>
+class FileInstrumentee
+{
+public:
+	explicit FileInstrumentee(const int = CAPACITE_DEFAUT, const int = 1);
+
+	void enfiler(const T &);
+	T defiler();
+
+	int taille() const;
+	bool estVide() const;
+	bool estPleine() const;
+
+	const T & premier() const;
+	const T & dernier() const;
+
+	const TelemetrieFile & telemetrie() const;
+	TelemetrieFile & telemetrie();
+
+private:
+	FileInstrumentee(const FileInstrumentee<T> &);
+	const FileInstrumentee<T> & operator =(const FileInstrumentee<T> &);
+
+	/**
+	 * \class Entree
+	 *
+	 * \brief Classe interne représentant un élément et son heure d'enfilement.
+	 */
+	class Entree
+	{
+	public:
+		T m_el; /*!< L'élément*/
+		std::uint64_t m_heure; /*!< Heure de l'enfilement, en ns, 0 si non échantillonné*/
+
+		Entree() :
+			m_el(), m_heure(0)
+		{
+		}
+
+		Entree(const T & el, std::uint64_t heure) :
+			m_el(el), m_heure(heure)
+		{
+		}
+	};
+
+	static const int CAPACITE_DEFAUT = 100; /*!< Capacité de la file par défaut, comme File*/
+
+	File<Entree> m_file; /*!< Les éléments horodatés*/
+	TelemetrieFile m_telemetrie; /*!< Les compteurs*/
+	const int m_periode; /*!< Un élément horodaté sur m_periode*/
+	int m_avantEchantillon; /*!< Enfilements avant le prochain élément horodaté*/
+};
+} //Fin du namespace
+
+#include "FileInstrumentee.hpp"
+
+#endif
@@ -0,0 +1,101 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité de la file
+ * \param[in] p_periode Un élément sur p_periode est horodaté
+ * \pre p_periode > 0
+ */
+template<typename T>
+FileInstrumentee<T>::FileInstrumentee(const int p_capacite, const int p_periode) :
+	m_file(p_capacite), m_periode(p_periode), m_avantEchantillon(0)
+{
+	PRECONDITION(p_periode > 0);
+}
+
+/**
+ * \brief Enfile un élément et note l'enfilement
+ * \param[in] p_el L'élément à enfiler
+ * \pre La file n'est pas pleine
+ */
+template<typename T>
+void FileInstrumentee<T>::enfiler(const T & p_el)
+{
+	std::uint64_t heure = 0;
+	if (m_avantEchantillon == 0)
+	{
+		heure = TelemetrieFile::maintenant();
+		m_avantEchantillon = m_periode;
+	}
+	--m_avantEchantillon;
+	m_file.enfiler(Entree(p_el, heure));
+	m_telemetrie.noterEnfilement(m_file.taille(), m_file.estPleine());
+}
+
+/**
+ * \brief Défile un élément et note son temps d'attente
+ * \return L'élément défilé
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+T FileInstrumentee<T>::defiler()
+{
+	Entree entree = m_file.defiler();
+	if (entree.m_heure != 0)
+		m_telemetrie.noterDefilement(m_file.taille(), TelemetrieFile::maintenant() - entree.m_heure);
+	else
+		m_telemetrie.noterDefilement(m_file.taille());
+	return std::move(entree.m_el);
+}
+
+template<typename T>
+int FileInstrumentee<T>::taille() const
+{
+	return m_file.taille();
+}
+
+template<typename T>
+bool FileInstrumentee<T>::estVide() const
+{
+	return m_file.estVide();
+}
+
+template<typename T>
+bool FileInstrumentee<T>::estPleine() const
+{
+	return m_file.estPleine();
+}
+
+template<typename T>
+const T & FileInstrumentee<T>::premier() const
+{
+	return m_file.premier().m_el;
+}
+
+template<typename T>
+const T & FileInstrumentee<T>::dernier() const
+{
+	return m_file.dernier().m_el;
+}
+
+/**
+ * \brief Retourne les compteurs, lisibles depuis n'importe quel fil
+ */
+template<typename T>
+const TelemetrieFile & FileInstrumentee<T>::telemetrie() const
+{
+	return m_telemetrie;
+}
+
+/**
+ * \brief Retourne les compteurs, par exemple pour les réinitialiser
+ */
+template<typename T>
+TelemetrieFile & FileInstrumentee<T>::telemetrie()
+{
+	return m_telemetrie;
+}
+
+} //Fin du namespace
@@ -0,0 +1,98 @@
+/**
+ * \file FileMPMC.h
+ * \brief Classe définissant une file bornée partagée par plusieurs producteurs et consommateurs
+ * \version 0.1
+ *
+ * Tableau circulaire de capacité fixe (une puissance de 2) dont chaque case
+ * porte un numéro de séquence (conception de Vyukov). Un producteur réserve
+ * une case par compare-and-swap sur l'indice de queue, y construit
+ * l'élément, puis publie la case en avançant son numéro; un consommateur
+ * fait de même avec l'indice de tête. Le numéro de séquence dit, sans
+ * verrou, si une case est libre pour le tour courant, déjà remplie ou
+ * encore occupée par le tour précédent.
+ */
+
+#ifndef _FILEMPMC_H
+#define _FILEMPMC_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lab04 {
+/**
+ * \class FileMPMC
+ *
+ * \brief classe générique représentant une File bornée partagée par plusieurs fils
+ *
+ *  enfiler et defiler peuvent être appelés en même temps par n'importe
+ *  quels fils; ils retournent false plutôt que d'attendre lorsque la file
+ *  est pleine ou vide, comme pour FileSPSC.
+ *
+ *  Une case réservée doit être remplie: le constructeur de copie (ou de
+ *  déplacement) de T ne doit pas lever d'exception.
+ */
+template<typename T>
+class FileMPMC
+{
+public:
+	explicit FileMPMC(const int = CAPACITE_DEFAUT);
+	~FileMPMC();
+
+	bool enfiler(const T &);
+	bool enfiler(T &&);
+	bool defiler(T &);
+
+	int taille() const;
+	bool estVide() const;
+	int capacite() const;
+
+private:
+	FileMPMC(const FileMPMC<T> &);
+	const FileMPMC<T> & operator =(const FileMPMC<T> &);
+
+	/**
+	 * \class Case
+	 *
+	 * \brief Classe interne représentant une case et son numéro de séquence.
+	 *
+	 * Pour la case d'indice i au tour k (position p = k * capacité + i):
+	 * m_sequence == p si elle est libre, p + 1 si elle contient l'élément.
+	 */
+	class Case
+	{
+	public:
+		std::atomic<std::size_t> m_sequence; /*!< Numéro de séquence de la case*/
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type m_el; /*!< L'élément, construit si la case est remplie*/
+
+		T * element()
+		{
+			return reinterpret_cast<T *>(&m_el);
+		}
+	};
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité de la file par défaut*/
+	static const std::size_t TAILLE_LIGNE = 64; /*!< Taille d'une ligne de cache*/
+
+	// Partagé en lecture seule
+	Case * const m_cases; /*!< Les cases, indicées modulo la capacité*/
+	const std::size_t m_masque; /*!< Capacité moins un*/
+	char m_bourrage0[TAILLE_LIGNE];
+
+	std::atomic<std::size_t> m_queue; /*!< Prochaine position à remplir, disputée par les producteurs*/
+	char m_bourrage1[TAILLE_LIGNE];
+
+	std::atomic<std::size_t> m_tete; /*!< Prochaine position à vider, disputée par les consommateurs*/
+	char m_bourrage2[TAILLE_LIGNE];
+
+	// Méthodes privées
+	template<typename U> bool _enfiler(U &&);
+};
+} //Fin du namespace
+
+#include "FileMPMC.hpp"
+
+#endif
@@ -0,0 +1,174 @@
+#include "ContratException.h"
+#include "PuissanceDe2.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité, arrondie à la puissance de 2 supérieure
+ * \pre 0 < p_capacite <= 2^30
+ * \post La file est vide
+ */
+template<typename T>
+FileMPMC<T>::FileMPMC(const int p_capacite) :
+	m_cases(new Case[puissanceDe2(p_capacite)]), m_masque(puissanceDe2(p_capacite) - 1),
+	m_queue(0), m_tete(0)
+{
+	for (std::size_t i = 0; i <= m_masque; ++i)
+	{
+		m_cases[i].m_sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * \brief Destructeur
+ *
+ * Détruit les éléments qui n'ont pas été défilés.
+ *
+ * \pre Aucun autre fil n'utilise la file
+ */
+template<typename T>
+FileMPMC<T>::~FileMPMC()
+{
+	std::size_t queue = m_queue.load(std::memory_order_acquire);
+	for (std::size_t i = m_tete.load(std::memory_order_acquire); i != queue; ++i)
+	{
+		m_cases[i & m_masque].element()->~T();
+	}
+	delete[] m_cases;
+}
+
+/**
+ * \brief Ajoute une copie d'un élément à la queue de la file
+ * \param[in] p_el L'élément à enfiler
+ * \return false si la file était pleine
+ */
+template<typename T>
+bool FileMPMC<T>::enfiler(const T & p_el)
+{
+	return _enfiler(p_el);
+}
+
+/**
+ * \brief Ajoute un élément à la queue de la file en le déplaçant
+ * \param[in] p_el L'élément à enfiler; déplacé seulement si la file n'était pas pleine
+ * \return false si la file était pleine
+ */
+template<typename T>
+bool FileMPMC<T>::enfiler(T && p_el)
+{
+	return _enfiler(std::move(p_el));
+}
+
+/**
+ * \brief Retire l'élément à la tête de la file
+ *
+ * La case est rendue aux producteurs du tour suivant en portant son
+ * numéro de séquence à position + capacité.
+ *
+ * \param[out] p_el Reçoit l'élément défilé
+ * \return false si la file était vide
+ */
+template<typename T>
+bool FileMPMC<T>::defiler(T & p_el)
+{
+	std::size_t position = m_tete.load(std::memory_order_relaxed);
+	Case * laCase;
+	for (;;)
+	{
+		laCase = &m_cases[position & m_masque];
+		std::size_t sequence = laCase->m_sequence.load(std::memory_order_acquire);
+		std::intptr_t ecart = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+		if (ecart == 0)
+		{
+			if (m_tete.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (ecart < 0)
+		{
+			return false;
+		}
+		else
+		{
+			position = m_tete.load(std::memory_order_relaxed);
+		}
+	}
+
+	T * el = laCase->element();
+	p_el = std::move(*el);
+	el->~T();
+	laCase->m_sequence.store(position + m_masque + 1, std::memory_order_release);
+	return true;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Sous accès concurrent, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int FileMPMC<T>::taille() const
+{
+	std::size_t tete = m_tete.load(std::memory_order_acquire);
+	std::size_t queue = m_queue.load(std::memory_order_acquire);
+	return queue > tete ? static_cast<int>(queue - tete) : 0;
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileMPMC<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Retourne la capacité de la file
+ */
+template<typename T>
+int FileMPMC<T>::capacite() const
+{
+	return static_cast<int>(m_masque + 1);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Réserve la case de queue, y construit l'élément, puis la publie
+ *
+ * \param[in] p_el L'élément à enfiler, copié ou déplacé
+ * \return false si la file était pleine
+ */
+template<typename T>
+template<typename U>
+bool FileMPMC<T>::_enfiler(U && p_el)
+{
+	std::size_t position = m_queue.load(std::memory_order_relaxed);
+	Case * laCase;
+	for (;;)
+	{
+		laCase = &m_cases[position & m_masque];
+		std::size_t sequence = laCase->m_sequence.load(std::memory_order_acquire);
+		std::intptr_t ecart = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+		if (ecart == 0)
+		{
+			if (m_queue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (ecart < 0)
+		{
+			return false;
+		}
+		else
+		{
+			position = m_queue.load(std::memory_order_relaxed);
+		}
+	}
+
+	new (laCase->element()) T(std::forward<U>(p_el));
+	laCase->m_sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+} //Fin du namespace
@@ -0,0 +1,92 @@
+/**
+ * \file FileMiroir.h
+ * \brief Classe définissant une file dont les zones lisible et inscriptible sont contiguës
+ * \version 0.1
+ *
+ * Tableau circulaire dont les pages sont projetées deux fois de suite en
+ * mémoire virtuelle (un memfd, projeté aux adresses m_tab et
+ * m_tab + capacité). La case i + capacité est donc la case i: une zone
+ * qui déborde de la fin du tableau se poursuit sans rupture dans la
+ * seconde projection, et n'a jamais à être coupée en deux.
+ *
+ * Linux seulement (memfd_create et mmap).
+ */
+
+#ifndef _FILEMIROIR_H
+#define _FILEMIROIR_H
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace lab04 {
+/**
+ * \class FileMiroir
+ *
+ * \brief classe générique représentant une File à zones contiguës
+ *
+ *  En plus de enfiler et defiler, la file expose directement ses zones:
+ *  zoneLecture donne tous les éléments présents et zoneEcriture toute la
+ *  place libre, chacune d'un seul tenant. Un analyseur peut ainsi lire
+ *  dans la file sans copie, et un read() ou un write() la remplir ou la
+ *  vider en un appel; valider et consommer avancent ensuite les indices.
+ *
+ *  La capacité est arrondie à un multiple de la taille d'une page. Les
+ *  éléments sont manipulés comme de la mémoire brute: T doit être
+ *  trivialement copiable.
+ */
+template<typename T>
+class FileMiroir
+{
+public:
+	explicit FileMiroir(const int = CAPACITE_DEFAUT);
+	~FileMiroir();
+
+	void enfiler(const T &);
+	T defiler();
+
+	const T * zoneLecture(int &) const;
+	void consommer(const int &);
+	T * zoneEcriture(int &);
+	void valider(const int &);
+
+	int taille() const;
+	bool estVide() const;
+	bool estPleine() const;
+	int capacite() const;
+
+	const T & premier() const;
+	const T & operator [](const int &) const;
+
+	void verifieInvariant() const;
+
+private:
+	FileMiroir(const FileMiroir<T> &);
+	const FileMiroir<T> & operator =(const FileMiroir<T> &);
+
+	static_assert(std::is_trivially_copyable<T>::value,
+			"FileMiroir manipule ses cases comme de la mémoire brute");
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité minimale de la file par défaut*/
+
+	T * m_tab; /*!< Première des deux projections; la seconde la suit*/
+	std::size_t m_octets; /*!< Taille d'une projection, un multiple de la page*/
+	int m_capacite; /*!< Nombre de cases d'une projection*/
+	int m_tete; /*!< Indice du premier élément, dans [0, m_capacite)*/
+	int m_cardinalite; /*!< Nombre d'éléments*/
+
+	// Méthodes privées
+	void _projeter();
+};
+} //Fin du namespace
+
+#include "FileMiroir.hpp"
+
+#endif
+
+#endif
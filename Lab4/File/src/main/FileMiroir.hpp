@@ -0,0 +1,218 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité minimale, arrondie à un multiple de la page
+ * \pre p_capacite > 0 et sizeof(T) divise la taille d'une page
+ * \post La file est vide
+ */
+template<typename T>
+FileMiroir<T>::FileMiroir(const int p_capacite) :
+	m_tab(0), m_octets(0), m_capacite(0), m_tete(0), m_cardinalite(0)
+{
+	const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	PRECONDITION(p_capacite > 0);
+	PRECONDITION(page % sizeof(T) == 0);
+
+	const std::size_t octets = static_cast<std::size_t>(p_capacite) * sizeof(T);
+	m_octets = (octets + page - 1) / page * page;
+	m_capacite = static_cast<int>(m_octets / sizeof(T));
+	_projeter();
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur, libère les deux projections
+ */
+template<typename T>
+FileMiroir<T>::~FileMiroir()
+{
+	munmap(m_tab, 2 * m_octets);
+}
+
+/**
+ * \brief Enfile un élément
+ * \param[in] p_el L'élément à enfiler
+ * \pre La file n'est pas pleine
+ */
+template<typename T>
+void FileMiroir<T>::enfiler(const T & p_el)
+{
+	PRECONDITION(m_cardinalite < m_capacite);
+
+	int libre = 0;
+	*zoneEcriture(libre) = p_el;
+	valider(1);
+}
+
+/**
+ * \brief Défile le premier élément
+ * \return L'élément défilé
+ * \pre La file n'est pas vide
+ */
+template<typename T>
+T FileMiroir<T>::defiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	T el = m_tab[m_tete];
+	consommer(1);
+	return el;
+}
+
+/**
+ * \brief Retourne la zone des éléments présents, d'un seul tenant
+ * \param[out] p_nombre Reçoit le nombre d'éléments de la zone, taille()
+ * \return L'adresse du premier élément
+ */
+template<typename T>
+const T * FileMiroir<T>::zoneLecture(int & p_nombre) const
+{
+	p_nombre = m_cardinalite;
+	return m_tab + m_tete;
+}
+
+/**
+ * \brief Retire les premiers éléments après une lecture dans zoneLecture
+ * \param[in] p_nombre Le nombre d'éléments lus
+ * \pre 0 <= p_nombre <= taille()
+ */
+template<typename T>
+void FileMiroir<T>::consommer(const int & p_nombre)
+{
+	PRECONDITION(p_nombre >= 0);
+	PRECONDITION(p_nombre <= m_cardinalite);
+
+	m_tete += p_nombre;
+	if (m_tete >= m_capacite)
+		m_tete -= m_capacite;
+	m_cardinalite -= p_nombre;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne la place libre à la queue, d'un seul tenant
+ * \param[out] p_nombre Reçoit le nombre de cases libres, capacite() - taille()
+ * \return L'adresse de la première case libre
+ */
+template<typename T>
+T * FileMiroir<T>::zoneEcriture(int & p_nombre)
+{
+	p_nombre = m_capacite - m_cardinalite;
+	return m_tab + m_tete + m_cardinalite;
+}
+
+/**
+ * \brief Ajoute à la file les éléments écrits dans zoneEcriture
+ * \param[in] p_nombre Le nombre d'éléments écrits
+ * \pre 0 <= p_nombre <= capacite() - taille()
+ */
+template<typename T>
+void FileMiroir<T>::valider(const int & p_nombre)
+{
+	PRECONDITION(p_nombre >= 0);
+	PRECONDITION(p_nombre <= m_capacite - m_cardinalite);
+
+	m_cardinalite += p_nombre;
+
+	INVARIANTS();
+}
+
+template<typename T>
+int FileMiroir<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+template<typename T>
+bool FileMiroir<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+template<typename T>
+bool FileMiroir<T>::estPleine() const
+{
+	return m_cardinalite == m_capacite;
+}
+
+template<typename T>
+int FileMiroir<T>::capacite() const
+{
+	return m_capacite;
+}
+
+template<typename T>
+const T & FileMiroir<T>::premier() const
+{
+	PRECONDITION(m_cardinalite > 0);
+	return m_tab[m_tete];
+}
+
+/**
+ * \brief Accède à un élément, sans calcul de modulo grâce à la seconde projection
+ * \param[in] p_index L'indice à partir de la tête, de 0 à taille() - 1
+ * \pre L'indice est valide
+ */
+template<typename T>
+const T & FileMiroir<T>::operator [](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	return m_tab[m_tete + p_index];
+}
+
+template<typename T>
+void FileMiroir<T>::verifieInvariant() const
+{
+	INVARIANT(m_tete >= 0 && m_tete < m_capacite);
+	INVARIANT(m_cardinalite >= 0 && m_cardinalite <= m_capacite);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Crée le memfd et le projette deux fois de suite
+ *
+ * Une plage de 2 * m_octets est d'abord réservée sans accès, puis ses deux
+ * moitiés sont remplacées (MAP_FIXED) par des projections partagées du
+ * même fichier: aucun autre mmap ne peut s'intercaler entre les deux.
+ */
+template<typename T>
+void FileMiroir<T>::_projeter()
+{
+	const int fd = static_cast<int>(syscall(SYS_memfd_create, "FileMiroir", 1u /* MFD_CLOEXEC */));
+	if (fd < 0)
+		throw std::runtime_error("FileMiroir: memfd_create a échoué");
+	if (ftruncate(fd, static_cast<off_t>(m_octets)) != 0)
+	{
+		close(fd);
+		throw std::runtime_error("FileMiroir: ftruncate a échoué");
+	}
+
+	void * plage = mmap(0, 2 * m_octets, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (plage == MAP_FAILED)
+	{
+		close(fd);
+		throw std::runtime_error("FileMiroir: réservation de l'espace d'adressage impossible");
+	}
+
+	char * base = static_cast<char *>(plage);
+	bool ok = mmap(base, m_octets, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED
+			&& mmap(base + m_octets, m_octets, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)
+					!= MAP_FAILED;
+	close(fd);
+	if (!ok)
+	{
+		munmap(plage, 2 * m_octets);
+		throw std::runtime_error("FileMiroir: projection en miroir impossible");
+	}
+	m_tab = reinterpret_cast<T *>(base);
+}
+
+} //Fin du namespace
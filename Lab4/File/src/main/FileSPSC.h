@@ -0,0 +1,81 @@
+/**
+ * \file FileSPSC.h
+ * \brief Classe définissant une file entre un seul producteur et un seul consommateur
+ * \version 0.1
+ *
+ * Tableau circulaire de capacité fixe (une puissance de 2), sans verrou.
+ * Le producteur est seul à écrire l'indice de queue et le consommateur est
+ * seul à écrire l'indice de tête; chacun publie son indice par une
+ * écriture release et lit celui de l'autre par une lecture acquire. Les
+ * deux indices sont sur des lignes de cache distinctes, et chaque côté
+ * garde une copie locale de l'indice de l'autre, relue seulement quand
+ * la file lui paraît pleine (producteur) ou vide (consommateur).
+ */
+
+#ifndef _FILESPSC_H
+#define _FILESPSC_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lab04 {
+/**
+ * \class FileSPSC
+ *
+ * \brief classe générique représentant une File partagée par deux fils
+ *
+ *  enfiler ne doit être appelé que par le fil producteur et defiler que
+ *  par le fil consommateur. Les deux retournent false plutôt que
+ *  d'attendre lorsque la file est pleine ou vide.
+ */
+template<typename T>
+class FileSPSC
+{
+public:
+	explicit FileSPSC(const int = CAPACITE_DEFAUT);
+	~FileSPSC();
+
+	bool enfiler(const T &);
+	bool enfiler(T &&);
+	bool defiler(T &);
+
+	int taille() const;
+	bool estVide() const;
+	int capacite() const;
+
+private:
+	FileSPSC(const FileSPSC<T> &);
+	const FileSPSC<T> & operator =(const FileSPSC<T> &);
+
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type case_t;
+
+	static const int CAPACITE_DEFAUT = 1024; /*!< Capacité de la file par défaut*/
+	static const std::size_t TAILLE_LIGNE = 64; /*!< Taille d'une ligne de cache*/
+
+	// Partagé en lecture seule
+	case_t * const m_tab; /*!< Les cases, indicées modulo la capacité*/
+	const std::size_t m_masque; /*!< Capacité moins un*/
+	char m_bourrage0[TAILLE_LIGNE];
+
+	// Écrit par le consommateur
+	std::atomic<std::size_t> m_tete; /*!< Nombre total d'éléments défilés*/
+	std::size_t m_queueConnue; /*!< Dernière valeur de m_queue lue par le consommateur*/
+	char m_bourrage1[TAILLE_LIGNE];
+
+	// Écrit par le producteur
+	std::atomic<std::size_t> m_queue; /*!< Nombre total d'éléments enfilés*/
+	std::size_t m_teteConnue; /*!< Dernière valeur de m_tete lue par le producteur*/
+	char m_bourrage2[TAILLE_LIGNE];
+
+	// Méthodes privées
+	template<typename U> bool _enfiler(U &&);
+	T * _case(std::size_t) const;
+};
+} //Fin du namespace
+
+#include "FileSPSC.hpp"
+
+#endif
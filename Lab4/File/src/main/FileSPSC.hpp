@@ -0,0 +1,155 @@
+#include "ContratException.h"
+#include "PuissanceDe2.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une file vide
+ * \param[in] p_capacite La capacité, arrondie à la puissance de 2 supérieure
+ * \pre 0 < p_capacite <= 2^30
+ * \post La file est vide
+ */
+template<typename T>
+FileSPSC<T>::FileSPSC(const int p_capacite) :
+	m_tab(new case_t[puissanceDe2(p_capacite)]), m_masque(puissanceDe2(p_capacite) - 1),
+	m_tete(0), m_queueConnue(0), m_queue(0), m_teteConnue(0)
+{
+}
+
+/**
+ * \brief Destructeur
+ *
+ * Détruit les éléments qui n'ont pas été défilés.
+ *
+ * \pre Ni le producteur ni le consommateur n'utilisent encore la file
+ */
+template<typename T>
+FileSPSC<T>::~FileSPSC()
+{
+	std::size_t queue = m_queue.load(std::memory_order_acquire);
+	for (std::size_t i = m_tete.load(std::memory_order_relaxed); i != queue; ++i)
+	{
+		_case(i)->~T();
+	}
+	delete[] m_tab;
+}
+
+/**
+ * \brief Ajoute une copie d'un élément à la queue de la file
+ * \param[in] p_el L'élément à enfiler
+ * \return false si la file était pleine
+ * \pre Appelé par le fil producteur
+ */
+template<typename T>
+bool FileSPSC<T>::enfiler(const T & p_el)
+{
+	return _enfiler(p_el);
+}
+
+/**
+ * \brief Ajoute un élément à la queue de la file en le déplaçant
+ * \param[in] p_el L'élément à enfiler; déplacé seulement si la file n'était pas pleine
+ * \return false si la file était pleine
+ * \pre Appelé par le fil producteur
+ */
+template<typename T>
+bool FileSPSC<T>::enfiler(T && p_el)
+{
+	return _enfiler(std::move(p_el));
+}
+
+/**
+ * \brief Retire l'élément à la tête de la file
+ *
+ * m_queue n'est relu que lorsque la copie locale indique une file vide.
+ *
+ * \param[out] p_el Reçoit l'élément défilé
+ * \return false si la file était vide
+ * \pre Appelé par le fil consommateur
+ */
+template<typename T>
+bool FileSPSC<T>::defiler(T & p_el)
+{
+	std::size_t tete = m_tete.load(std::memory_order_relaxed);
+	if (tete == m_queueConnue)
+	{
+		m_queueConnue = m_queue.load(std::memory_order_acquire);
+		if (tete == m_queueConnue)
+			return false;
+	}
+
+	T * el = _case(tete);
+	p_el = std::move(*el);
+	el->~T();
+	m_tete.store(tete + 1, std::memory_order_release);
+	return true;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Vu d'un troisième fil, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int FileSPSC<T>::taille() const
+{
+	std::size_t tete = m_tete.load(std::memory_order_acquire);
+	std::size_t queue = m_queue.load(std::memory_order_acquire);
+	return queue > tete ? static_cast<int>(queue - tete) : 0;
+}
+
+/**
+ * \brief Vérifie si la file est vide
+ */
+template<typename T>
+bool FileSPSC<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Retourne la capacité de la file
+ */
+template<typename T>
+int FileSPSC<T>::capacite() const
+{
+	return static_cast<int>(m_masque + 1);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Construit un élément dans la case de queue, puis le publie
+ *
+ * m_tete n'est relu que lorsque la copie locale indique une file pleine.
+ *
+ * \param[in] p_el L'élément à enfiler, copié ou déplacé
+ * \return false si la file était pleine
+ */
+template<typename T>
+template<typename U>
+bool FileSPSC<T>::_enfiler(U && p_el)
+{
+	std::size_t queue = m_queue.load(std::memory_order_relaxed);
+	if (queue - m_teteConnue > m_masque)
+	{
+		m_teteConnue = m_tete.load(std::memory_order_acquire);
+		if (queue - m_teteConnue > m_masque)
+			return false;
+	}
+
+	new (_case(queue)) T(std::forward<U>(p_el));
+	m_queue.store(queue + 1, std::memory_order_release);
+	return true;
+}
+
+/**
+ * \brief Retourne l'adresse de la case d'un indice, modulo la capacité
+ */
+template<typename T>
+T * FileSPSC<T>::_case(std::size_t p_indice) const
+{
+	return reinterpret_cast<T *>(m_tab + (p_indice & m_masque));
+}
+
+} //Fin du namespace
@@ -0,0 +1,36 @@
+/**
+ * \file PuissanceDe2.h
+ * \brief Arrondi d'une capacité à une puissance de 2
+ * \version 0.1
+ *
+ * Partagé par les files en anneau (FileAnneau, FileDouble, FileSPSC,
+ * FileMPMC), dont les indices reviennent au début du tableau par un
+ * masque de bits.
+ */
+
+#ifndef _PUISSANCEDE2_H
+#define _PUISSANCEDE2_H
+
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Retourne la plus petite puissance de 2 supérieure ou égale à p_n
+ * \pre 0 < p_n <= 2^30
+ */
+inline int puissanceDe2(int p_n)
+{
+	PRECONDITION(p_n > 0 && p_n <= (1 << 30));
+
+	int puissance = 1;
+	while (puissance < p_n)
+	{
+		puissance *= 2;
+	}
+	return puissance;
+}
+
+} //Fin du namespace
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * \file RoueTemporelle.h
+ * \brief Classe définissant une file de minuteries (roue temporelle hiérarchique)
+ * \version 0.1
+ *
+ * Quatre niveaux de 64 cases, chacun un anneau indicé par masque comme
+ * FileAnneau. Une case du niveau n couvre 64^n tops: une minuterie est
+ * rangée au niveau le plus bas dont l'horizon couvre son délai. Quand le
+ * temps atteint une case d'un niveau supérieur, ses minuteries descendent
+ * (cascade) dans les niveaux inférieurs; celles de la case courante du
+ * niveau 0 sont échues.
+ *
+ * Chaque case est une liste doublement chaînée de minuteries, chaînées
+ * par indices dans un réservoir commun: planifier et annuler sont en O(1).
+ */
+
+#ifndef _ROUETEMPORELLE_H
+#define _ROUETEMPORELLE_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace lab04 {
+/**
+ * \class RoueTemporelle
+ *
+ * \brief classe générique représentant une file de minuteries
+ *
+ *  Le temps est un compteur de tops. planifier(el, delai) fait échoir el
+ *  quand le temps aura avancé de delai tops; avancer fait passer le temps
+ *  et écrit les éléments échus, par lots, dans une sortie. Les éléments
+ *  d'un même top sortent dans un ordre quelconque.
+ *
+ *  avancer saute d'un coup les périodes où les niveaux inférieurs sont
+ *  vides: son coût dépend du nombre de minuteries traitées, pas du nombre
+ *  de tops écoulés. Un délai plus long que l'horizon de la roue (64^4
+ *  tops) est ramené à l'horizon, puis replanifié à chaque passage au
+ *  dernier niveau jusqu'à son échéance.
+ */
+template<typename T>
+class RoueTemporelle
+{
+public:
+	typedef std::uint64_t Poignee; /*!< Désigne une minuterie; périmée quand elle échoit ou est annulée*/
+	typedef std::uint64_t Temps; /*!< Un nombre de tops*/
+
+	explicit RoueTemporelle(const Temps = 0);
+
+	Poignee planifier(const T &, const Temps &);
+	bool annuler(const Poignee &);
+	template<typename Sortie> int avancer(const Temps &, Sortie);
+
+	Temps maintenant() const;
+	int taille() const;
+	bool estVide() const;
+	bool estActive(const Poignee &) const;
+
+	void verifieInvariant() const;
+
+private:
+	/**
+	 * \class Minuterie
+	 *
+	 * \brief Classe interne représentant une minuterie dans le réservoir.
+	 */
+	class Minuterie
+	{
+	public:
+		T m_el; /*!< L'élément rendu à l'échéance*/
+		Temps m_echeance; /*!< Le temps absolu de l'échéance*/
+		int m_precedent; /*!< Minuterie précédente dans la case, -1 si première*/
+		int m_suivant; /*!< Minuterie suivante dans la case, ou dans la liste des libres*/
+		int m_case; /*!< Case globale (niveau * TAILLE_NIVEAU + case), -1 si libre*/
+		std::uint32_t m_generation; /*!< Incrémentée à chaque libération*/
+
+		explicit Minuterie(const T & el) :
+			m_el(el), m_echeance(0), m_precedent(-1), m_suivant(-1), m_case(-1), m_generation(0)
+		{
+		}
+	};
+
+	static const int NIVEAUX = 4; /*!< Nombre de niveaux de la roue*/
+	static const int BITS_NIVEAU = 6; /*!< log2 du nombre de cases d'un niveau*/
+	static const int TAILLE_NIVEAU = 1 << BITS_NIVEAU; /*!< Cases par niveau*/
+	static const int MASQUE_NIVEAU = TAILLE_NIVEAU - 1; /*!< Masque d'indice dans un niveau*/
+
+	std::vector<Minuterie> m_reservoir; /*!< Toutes les minuteries, actives ou libres*/
+	int m_libres; /*!< Première minuterie libre, -1 si aucune*/
+	int m_tetes[NIVEAUX * TAILLE_NIVEAU]; /*!< Première minuterie de chaque case, -1 si vide*/
+	std::uint64_t m_occupation[NIVEAUX]; /*!< Bit i: la case i du niveau est non vide*/
+	Temps m_maintenant; /*!< Le dernier top traité*/
+	int m_cardinalite; /*!< Nombre de minuteries actives*/
+
+	// Méthodes privées
+	void _ranger(int);
+	void _detacher(int);
+	void _liberer(int);
+	void _cascader(int);
+	static int _premierBit(std::uint64_t);
+	static Poignee _poignee(int, std::uint32_t);
+};
+} //Fin du namespace
+
+#include "RoueTemporelle.hpp"
+
+#endif
@@ -0,0 +1,311 @@
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur d'une roue vide
+ * \param[in] p_maintenant Le temps de départ
+ */
+template<typename T>
+RoueTemporelle<T>::RoueTemporelle(const Temps p_maintenant) :
+	m_libres(-1), m_maintenant(p_maintenant), m_cardinalite(0)
+{
+	for (int i = 0; i < NIVEAUX * TAILLE_NIVEAU; ++i)
+		m_tetes[i] = -1;
+	for (int n = 0; n < NIVEAUX; ++n)
+		m_occupation[n] = 0;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Planifie une minuterie, en O(1)
+ * \param[in] p_el L'élément rendu à l'échéance
+ * \param[in] p_delai Le nombre de tops avant l'échéance
+ * \return La poignée de la minuterie, pour annuler
+ * \pre p_delai > 0
+ */
+template<typename T>
+typename RoueTemporelle<T>::Poignee RoueTemporelle<T>::planifier(const T & p_el, const Temps & p_delai)
+{
+	PRECONDITION(p_delai > 0);
+
+	int indice = m_libres;
+	if (indice >= 0)
+	{
+		m_libres = m_reservoir[indice].m_suivant;
+		m_reservoir[indice].m_el = p_el;
+	}
+	else
+	{
+		indice = static_cast<int>(m_reservoir.size());
+		m_reservoir.push_back(Minuterie(p_el));
+	}
+	m_reservoir[indice].m_echeance = m_maintenant + p_delai;
+	_ranger(indice);
+	++m_cardinalite;
+
+	INVARIANTS();
+	return _poignee(indice, m_reservoir[indice].m_generation);
+}
+
+/**
+ * \brief Annule une minuterie, en O(1)
+ * \param[in] p_poignee La poignée retournée par planifier
+ * \return false si la minuterie était déjà échue ou annulée
+ */
+template<typename T>
+bool RoueTemporelle<T>::annuler(const Poignee & p_poignee)
+{
+	if (!estActive(p_poignee))
+		return false;
+
+	const int indice = static_cast<int>(p_poignee & 0xffffffffu);
+	_detacher(indice);
+	_liberer(indice);
+	--m_cardinalite;
+
+	INVARIANTS();
+	return true;
+}
+
+/**
+ * \brief Fait avancer le temps et récolte les minuteries échues
+ *
+ * Pour chaque top: les cases des niveaux supérieurs qui commencent à ce
+ * top descendent d'abord, puis la case courante du niveau 0 est vidée
+ * d'un bloc dans la sortie. Les tops sans travail sont sautés: jusqu'à la
+ * prochaine case occupée du niveau 0 (trouvée dans le masque
+ * d'occupation), ou jusqu'à la prochaine cascade utile.
+ *
+ * \param[in] p_tops Le nombre de tops écoulés
+ * \param[out] p_sortie Reçoit les éléments échus, par ordre d'échéance
+ * \return Le nombre d'éléments échus
+ */
+template<typename T>
+template<typename Sortie>
+int RoueTemporelle<T>::avancer(const Temps & p_tops, Sortie p_sortie)
+{
+	const Temps cible = m_maintenant + p_tops;
+	int echues = 0;
+	while (m_maintenant < cible)
+	{
+		if (m_cardinalite == 0)
+		{
+			m_maintenant = cible;
+			break;
+		}
+
+		// Aucun travail avant la prochaine case occupée du niveau 0, ou
+		// avant la prochaine cascade du plus bas niveau occupé.
+		int niveau = 0;
+		while (m_occupation[niveau] == 0)
+			++niveau;
+		Temps dernierTopLibre = m_maintenant | ((Temps(1) << (BITS_NIVEAU * niveau)) - 1);
+		if (niveau == 0)
+		{
+			const std::uint64_t plusLoin = m_occupation[0]
+					& ~((std::uint64_t(2) << (m_maintenant & MASQUE_NIVEAU)) - 1);
+			if (plusLoin != 0)
+				dernierTopLibre = (m_maintenant & ~Temps(MASQUE_NIVEAU)) + _premierBit(plusLoin) - 1;
+		}
+		if (dernierTopLibre >= cible)
+		{
+			m_maintenant = cible;
+			break;
+		}
+		m_maintenant = dernierTopLibre;
+
+		++m_maintenant;
+		for (int n = 1; n < NIVEAUX; ++n)
+		{
+			if (((m_maintenant >> (BITS_NIVEAU * (n - 1))) & MASQUE_NIVEAU) != 0)
+				break;
+			_cascader(n);
+		}
+
+		const int laCase = static_cast<int>(m_maintenant & MASQUE_NIVEAU);
+		int indice = m_tetes[laCase];
+		m_tetes[laCase] = -1;
+		m_occupation[0] &= ~(std::uint64_t(1) << laCase);
+		while (indice >= 0)
+		{
+			Minuterie & minuterie = m_reservoir[indice];
+			const int suivant = minuterie.m_suivant;
+			ASSERTION(minuterie.m_echeance == m_maintenant);
+			*p_sortie = std::move(minuterie.m_el);
+			++p_sortie;
+			_liberer(indice);
+			--m_cardinalite;
+			++echues;
+			indice = suivant;
+		}
+	}
+
+	INVARIANTS();
+	return echues;
+}
+
+/**
+ * \brief Retourne le temps courant
+ */
+template<typename T>
+typename RoueTemporelle<T>::Temps RoueTemporelle<T>::maintenant() const
+{
+	return m_maintenant;
+}
+
+/**
+ * \brief Retourne le nombre de minuteries actives
+ */
+template<typename T>
+int RoueTemporelle<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Vérifie s'il n'y a aucune minuterie active
+ */
+template<typename T>
+bool RoueTemporelle<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Vérifie si une poignée désigne une minuterie encore active
+ */
+template<typename T>
+bool RoueTemporelle<T>::estActive(const Poignee & p_poignee) const
+{
+	const std::uint64_t indice = p_poignee & 0xffffffffu;
+	return indice < m_reservoir.size() && m_reservoir[indice].m_case >= 0
+			&& m_reservoir[indice].m_generation == static_cast<std::uint32_t>(p_poignee >> 32);
+}
+
+/**
+ * \brief Vérifie la cohérence entre le réservoir et la cardinalité
+ */
+template<typename T>
+void RoueTemporelle<T>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0 && m_cardinalite <= static_cast<int>(m_reservoir.size()));
+	INVARIANT(m_cardinalite > 0 || (m_occupation[0] | m_occupation[1] | m_occupation[2] | m_occupation[3]) == 0);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Range une minuterie dans la case qui correspond à son échéance
+ *
+ * Le niveau est le plus bas dont l'horizon, 64^(niveau + 1) tops, couvre
+ * le délai restant; au-delà du dernier niveau, l'échéance est ramenée à
+ * l'horizon le temps de choisir la case.
+ */
+template<typename T>
+void RoueTemporelle<T>::_ranger(int p_indice)
+{
+	Minuterie & minuterie = m_reservoir[p_indice];
+	const Temps delai = minuterie.m_echeance - m_maintenant;
+	Temps echeance = minuterie.m_echeance;
+	int niveau = 0;
+	while (niveau < NIVEAUX - 1 && delai >= (Temps(1) << (BITS_NIVEAU * (niveau + 1))))
+		++niveau;
+	if (niveau == NIVEAUX - 1 && delai >= (Temps(1) << (BITS_NIVEAU * NIVEAUX)))
+		echeance = m_maintenant + (Temps(1) << (BITS_NIVEAU * NIVEAUX)) - 1;
+
+	const int laCase = static_cast<int>((echeance >> (BITS_NIVEAU * niveau)) & MASQUE_NIVEAU);
+	const int globale = niveau * TAILLE_NIVEAU + laCase;
+	minuterie.m_case = globale;
+	minuterie.m_precedent = -1;
+	minuterie.m_suivant = m_tetes[globale];
+	if (m_tetes[globale] >= 0)
+		m_reservoir[m_tetes[globale]].m_precedent = p_indice;
+	m_tetes[globale] = p_indice;
+	m_occupation[niveau] |= std::uint64_t(1) << laCase;
+}
+
+/**
+ * \brief Retire une minuterie de sa case
+ */
+template<typename T>
+void RoueTemporelle<T>::_detacher(int p_indice)
+{
+	Minuterie & minuterie = m_reservoir[p_indice];
+	if (minuterie.m_precedent >= 0)
+		m_reservoir[minuterie.m_precedent].m_suivant = minuterie.m_suivant;
+	else
+		m_tetes[minuterie.m_case] = minuterie.m_suivant;
+	if (minuterie.m_suivant >= 0)
+		m_reservoir[minuterie.m_suivant].m_precedent = minuterie.m_precedent;
+
+	if (m_tetes[minuterie.m_case] < 0)
+		m_occupation[minuterie.m_case / TAILLE_NIVEAU] &= ~(std::uint64_t(1) << (minuterie.m_case & MASQUE_NIVEAU));
+}
+
+/**
+ * \brief Remet une minuterie détachée dans la liste des libres
+ *
+ * Sa génération change, ce qui périme les poignées qui la désignent.
+ */
+template<typename T>
+void RoueTemporelle<T>::_liberer(int p_indice)
+{
+	Minuterie & minuterie = m_reservoir[p_indice];
+	minuterie.m_case = -1;
+	++minuterie.m_generation;
+	minuterie.m_suivant = m_libres;
+	m_libres = p_indice;
+}
+
+/**
+ * \brief Fait descendre les minuteries de la case courante d'un niveau
+ * \param[in] p_niveau Le niveau, de 1 à NIVEAUX - 1
+ */
+template<typename T>
+void RoueTemporelle<T>::_cascader(int p_niveau)
+{
+	const int laCase = static_cast<int>((m_maintenant >> (BITS_NIVEAU * p_niveau)) & MASQUE_NIVEAU);
+	const int globale = p_niveau * TAILLE_NIVEAU + laCase;
+	int indice = m_tetes[globale];
+	m_tetes[globale] = -1;
+	m_occupation[p_niveau] &= ~(std::uint64_t(1) << laCase);
+	while (indice >= 0)
+	{
+		const int suivant = m_reservoir[indice].m_suivant;
+		_ranger(indice);
+		indice = suivant;
+	}
+}
+
+/**
+ * \brief Retourne l'indice du bit le plus bas à 1
+ * \pre p_bits != 0
+ */
+template<typename T>
+int RoueTemporelle<T>::_premierBit(std::uint64_t p_bits)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(p_bits);
+#else
+	int bit = 0;
+	while ((p_bits & 1) == 0)
+	{
+		p_bits >>= 1;
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+/**
+ * \brief Combine un indice et une génération en poignée
+ */
+template<typename T>
+typename RoueTemporelle<T>::Poignee RoueTemporelle<T>::_poignee(int p_indice, std::uint32_t p_generation)
+{
+	return (static_cast<Poignee>(p_generation) << 32) | static_cast<std::uint32_t>(p_indice);
+}
+
+} //Fin du namespace
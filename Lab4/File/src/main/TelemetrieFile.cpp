@@ -0,0 +1,225 @@
+/**
+ * \file TelemetrieFile.cpp
+ * \brief Implémentation de la classe TelemetrieFile
+ * \version 0.1
+ */
+
+#include "TelemetrieFile.h"
+#include "ContratException.h"
+
+namespace lab04 {
+
+/**
+ * \brief Constructeur, tous les compteurs à zéro
+ */
+TelemetrieFile::TelemetrieFile() :
+	m_enfilements(0), m_defilements(0), m_tailleMaximale(0), m_evenementsPleine(0),
+	m_evenementsVide(0), m_debut(maintenant())
+{
+	for (int i = 0; i < NOMBRE_CASES; ++i)
+		m_attentes[i].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Note un enfilement
+ * \param[in] p_taille La taille de la file après l'enfilement
+ * \param[in] p_pleine Vrai si l'enfilement a rempli la file
+ */
+void TelemetrieFile::noterEnfilement(const int & p_taille, const bool & p_pleine)
+{
+	m_enfilements.fetch_add(1, std::memory_order_relaxed);
+	if (p_pleine)
+		m_evenementsPleine.fetch_add(1, std::memory_order_relaxed);
+
+	int maximum = m_tailleMaximale.load(std::memory_order_relaxed);
+	while (p_taille > maximum
+			&& !m_tailleMaximale.compare_exchange_weak(maximum, p_taille, std::memory_order_relaxed))
+	{
+	}
+}
+
+/**
+ * \brief Note un défilement dont l'attente n'a pas été mesurée
+ * \param[in] p_taille La taille de la file après le défilement
+ */
+void TelemetrieFile::noterDefilement(const int & p_taille)
+{
+	m_defilements.fetch_add(1, std::memory_order_relaxed);
+	if (p_taille == 0)
+		m_evenementsVide.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Note un défilement et son attente
+ * \param[in] p_taille La taille de la file après le défilement
+ * \param[in] p_attente Le temps passé dans la file par l'élément défilé, en ns
+ */
+void TelemetrieFile::noterDefilement(const int & p_taille, const std::uint64_t & p_attente)
+{
+	noterDefilement(p_taille);
+	m_attentes[_case(p_attente)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Remet les compteurs à zéro et recommence la mesure des débits
+ *
+ * Les opérations concurrentes à la remise à zéro peuvent être comptées
+ * d'un côté ou de l'autre.
+ */
+void TelemetrieFile::reinitialiser()
+{
+	m_enfilements.store(0, std::memory_order_relaxed);
+	m_defilements.store(0, std::memory_order_relaxed);
+	m_tailleMaximale.store(0, std::memory_order_relaxed);
+	m_evenementsPleine.store(0, std::memory_order_relaxed);
+	m_evenementsVide.store(0, std::memory_order_relaxed);
+	for (int i = 0; i < NOMBRE_CASES; ++i)
+		m_attentes[i].store(0, std::memory_order_relaxed);
+	m_debut.store(maintenant(), std::memory_order_relaxed);
+}
+
+std::uint64_t TelemetrieFile::enfilements() const
+{
+	return m_enfilements.load(std::memory_order_relaxed);
+}
+
+std::uint64_t TelemetrieFile::defilements() const
+{
+	return m_defilements.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne la plus grande taille observée après un enfilement
+ */
+int TelemetrieFile::tailleMaximale() const
+{
+	return m_tailleMaximale.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le nombre d'enfilements qui ont rempli la file
+ */
+std::uint64_t TelemetrieFile::evenementsPleine() const
+{
+	return m_evenementsPleine.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le nombre de défilements qui ont vidé la file
+ */
+std::uint64_t TelemetrieFile::evenementsVide() const
+{
+	return m_evenementsVide.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le nombre moyen d'enfilements par seconde depuis le début de la mesure
+ */
+double TelemetrieFile::debitEnfilement() const
+{
+	const double secondes = _secondes();
+	return secondes > 0 ? static_cast<double>(enfilements()) / secondes : 0;
+}
+
+/**
+ * \brief Retourne le nombre moyen de défilements par seconde depuis le début de la mesure
+ */
+double TelemetrieFile::debitDefilement() const
+{
+	const double secondes = _secondes();
+	return secondes > 0 ? static_cast<double>(defilements()) / secondes : 0;
+}
+
+/**
+ * \brief Retourne un quantile du temps d'attente dans la file
+ *
+ * La valeur est la borne supérieure de la case qui contient le quantile:
+ * elle le surestime d'au plus 12,5 %.
+ *
+ * \param[in] p_quantile Le quantile, de 0 à 1 (0,5 pour la médiane)
+ * \return L'attente en ns, 0 si aucun élément n'a été défilé
+ * \pre 0 <= p_quantile <= 1
+ */
+std::uint64_t TelemetrieFile::attente(const double & p_quantile) const
+{
+	PRECONDITION(p_quantile >= 0 && p_quantile <= 1);
+
+	std::uint64_t comptes[NOMBRE_CASES];
+	std::uint64_t total = 0;
+	for (int i = 0; i < NOMBRE_CASES; ++i)
+	{
+		comptes[i] = m_attentes[i].load(std::memory_order_relaxed);
+		total += comptes[i];
+	}
+	if (total == 0)
+		return 0;
+
+	std::uint64_t rang = static_cast<std::uint64_t>(p_quantile * static_cast<double>(total));
+	if (rang == 0)
+		rang = 1;
+	std::uint64_t cumul = 0;
+	for (int i = 0; i < NOMBRE_CASES; ++i)
+	{
+		cumul += comptes[i];
+		if (cumul >= rang)
+			return _borneSuperieure(i);
+	}
+	return _borneSuperieure(NOMBRE_CASES - 1);
+}
+
+/**
+ * \brief Retourne l'heure de l'horloge monotone, en ns
+ */
+std::uint64_t TelemetrieFile::maintenant()
+{
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			horloge::now().time_since_epoch()).count());
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne les secondes écoulées depuis le début de la mesure
+ */
+double TelemetrieFile::_secondes() const
+{
+	return static_cast<double>(maintenant() - m_debut.load(std::memory_order_relaxed)) * 1e-9;
+}
+
+/**
+ * \brief Retourne la case de l'histogramme d'une valeur
+ *
+ * Les valeurs 0 à 7 ont chacune leur case. Au-delà, les trois bits qui
+ * suivent le bit le plus fort choisissent l'une des 8 cases de la
+ * puissance de 2.
+ */
+int TelemetrieFile::_case(std::uint64_t p_valeur)
+{
+	if (p_valeur < SOUS_CASES)
+		return static_cast<int>(p_valeur);
+
+#if defined(__GNUC__)
+	const int exposant = 63 - __builtin_clzll(p_valeur);
+#else
+	int exposant = 63;
+	while ((p_valeur >> exposant) == 0)
+		--exposant;
+#endif
+	const int sousCase = static_cast<int>((p_valeur >> (exposant - 3)) & (SOUS_CASES - 1));
+	return (exposant - 2) * SOUS_CASES + sousCase;
+}
+
+/**
+ * \brief Retourne la plus grande valeur rangée dans une case
+ */
+std::uint64_t TelemetrieFile::_borneSuperieure(int p_case)
+{
+	if (p_case < SOUS_CASES)
+		return static_cast<std::uint64_t>(p_case);
+
+	const int exposant = p_case / SOUS_CASES + 2;
+	const std::uint64_t sousCase = static_cast<std::uint64_t>(p_case % SOUS_CASES);
+	return ((SOUS_CASES + sousCase + 1) << (exposant - 3)) - 1;
+}
+
+} //Fin du namespace
@@ -0,0 +1,82 @@
+/**
+ * \file TelemetrieFile.h
+ * \brief Classe définissant les compteurs d'activité d'une file
+ * \version 0.1
+ *
+ * Compteurs atomiques (relaxed) que la file met à jour à chaque opération
+ * et qu'un autre fil peut lire à tout moment, sans verrou et sans arrêter
+ * les producteurs: nombres d'enfilements et de défilements, taille
+ * maximale atteinte, nombre de fois où la file est devenue pleine ou
+ * vide, et histogramme des temps d'attente dans la file.
+ *
+ * L'histogramme est log-linéaire, comme HdrHistogram: chaque puissance de
+ * 2 est coupée en 8 cases égales, ce qui borne l'erreur relative d'un
+ * quantile à 12,5 % pour des attentes de 1 ns à plusieurs siècles, dans
+ * un tableau fixe de 496 compteurs.
+ */
+
+#ifndef _TELEMETRIEFILE_H
+#define _TELEMETRIEFILE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace lab04 {
+/**
+ * \class TelemetrieFile
+ *
+ * \brief Compteurs d'activité d'une file, lisibles pendant qu'elle travaille
+ *
+ *  La file appelle noterEnfilement et noterDefilement; n'importe quel fil
+ *  peut lire les compteurs. Chaque compteur est exact, mais deux lectures
+ *  successives ne forment pas un instantané cohérent de l'ensemble.
+ */
+class TelemetrieFile
+{
+public:
+	typedef std::chrono::steady_clock horloge;
+
+	TelemetrieFile();
+
+	void noterEnfilement(const int &, const bool &);
+	void noterDefilement(const int &);
+	void noterDefilement(const int &, const std::uint64_t &);
+	void reinitialiser();
+
+	std::uint64_t enfilements() const;
+	std::uint64_t defilements() const;
+	int tailleMaximale() const;
+	std::uint64_t evenementsPleine() const;
+	std::uint64_t evenementsVide() const;
+
+	double debitEnfilement() const;
+	double debitDefilement() const;
+
+	std::uint64_t attente(const double &) const;
+
+	static std::uint64_t maintenant();
+
+private:
+	TelemetrieFile(const TelemetrieFile &);
+	TelemetrieFile & operator =(const TelemetrieFile &);
+
+	static const int SOUS_CASES = 8; /*!< Cases par puissance de 2*/
+	static const int NOMBRE_CASES = 496; /*!< (64 - 2) puissances de 2 à partir de 8, plus 0 à 7*/
+
+	std::atomic<std::uint64_t> m_enfilements; /*!< Nombre d'enfilements*/
+	std::atomic<std::uint64_t> m_defilements; /*!< Nombre de défilements*/
+	std::atomic<int> m_tailleMaximale; /*!< Plus grande taille observée*/
+	std::atomic<std::uint64_t> m_evenementsPleine; /*!< Enfilements qui ont rempli la file*/
+	std::atomic<std::uint64_t> m_evenementsVide; /*!< Défilements qui ont vidé la file*/
+	std::atomic<std::uint64_t> m_debut; /*!< Départ de la mesure des débits, en ns*/
+	std::atomic<std::uint64_t> m_attentes[NOMBRE_CASES]; /*!< Histogramme des attentes, en ns*/
+
+	// Méthodes privées
+	double _secondes() const;
+	static int _case(std::uint64_t);
+	static std::uint64_t _borneSuperieure(int);
+};
+} //Fin du namespace
+
+#endif
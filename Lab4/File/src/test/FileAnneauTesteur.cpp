@@ -0,0 +1,177 @@
+/**
+ * \file FileAnneauTesteur.cpp
+ * \brief Tests de la classe FileAnneau en format Google Test
+ * \version 0.1
+ *
+ * Représentation dans un tableau circulaire extensible
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileAnneau.h"
+#include <sstream>
+
+using namespace lab04;
+static const int val1 = 10;
+static const int val2 = 20;
+static const int val3 = 30;
+
+class FileAnneauTest: public ::testing::Test {
+public:
+	virtual void SetUp() {
+		file2.enfiler(val1);
+		file2.enfiler(val2);
+		file2.enfiler(val3);
+	}
+	// virtual void TearDown() {}
+	FileAnneau<int> file1;
+	FileAnneau<int> file2;
+};
+
+TEST_F(FileAnneauTest, FileVideOK) {
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+}
+
+TEST_F(FileAnneauTest, EnfileUnElementOK) {
+	file1.enfiler(val1);
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_FALSE(file1.estVide());
+	EXPECT_EQ(1, file1.taille());
+	EXPECT_EQ(val1, file1.defiler());
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+}
+
+TEST_F(FileAnneauTest, EnfileTroisElementsOK) {
+	file1.enfiler(val1);
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_EQ(val1, file1.dernier());
+	file1.enfiler(val2);
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_EQ(val2, file1.dernier());
+	file1.enfiler(val3);
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_EQ(val3, file1.dernier());
+
+	EXPECT_EQ(val1, file1.defiler());
+	EXPECT_EQ(val2, file1.defiler());
+	EXPECT_EQ(val3, file1.defiler());
+	EXPECT_TRUE(file1.estVide());
+}
+
+TEST_F(FileAnneauTest, TestCaseOperateurEgal) {
+	FileAnneau<int> autre = file1;
+
+	EXPECT_EQ(autre.taille(), file1.taille());
+
+	autre = file2;
+
+	EXPECT_EQ(autre.taille(), file2.taille());
+	EXPECT_EQ(autre.premier(), file2.premier());
+	EXPECT_EQ(autre.dernier(), file2.dernier());
+}
+
+TEST_F(FileAnneauTest, TestCaseConstructeurCopie) {
+	FileAnneau<int> autre2(file1);
+
+	EXPECT_EQ(autre2.taille(), file1.taille());
+
+	FileAnneau<int> autre(file2);
+
+	EXPECT_EQ(autre.taille(), file2.taille());
+	EXPECT_EQ(autre.premier(), file2.premier());
+	EXPECT_EQ(autre.dernier(), file2.dernier());
+}
+
+TEST_F(FileAnneauTest, TestCaseOperateurFlotSortie) {
+	std::ostringstream oss;
+	oss << file2;
+
+	EXPECT_EQ("[10,20,30,]", oss.str());
+}
+
+TEST_F(FileAnneauTest, operatorCrochetErreur) {
+	file1.enfiler(5);
+	EXPECT_THROW(file1[-1], PreconditionException);
+	EXPECT_THROW(file1[2], PreconditionException);
+}
+
+TEST_F(FileAnneauTest, operatorCrochetOk) {
+	EXPECT_EQ(val1, file2[0]);
+	EXPECT_EQ(val2, file2[1]);
+	EXPECT_EQ(val3, file2[2]);
+}
+
+TEST_F(FileAnneauTest, capaciteArrondieAPuissanceDe2) {
+	EXPECT_EQ(16, file1.capacite());
+	FileAnneau<int> f(100);
+	EXPECT_EQ(128, f.capacite());
+	FileAnneau<int> g(1);
+	EXPECT_EQ(1, g.capacite());
+	EXPECT_THROW(FileAnneau<int> invalide(0), PreconditionException);
+}
+
+TEST_F(FileAnneauTest, agrandissementDerouleLAnneau) {
+	FileAnneau<int> f(4);
+	for (int i = 0; i < 3; ++i)
+		f.enfiler(i);
+	EXPECT_EQ(0, f.defiler());
+	EXPECT_EQ(1, f.defiler());
+	for (int i = 3; i < 6; ++i)
+		f.enfiler(i);
+	EXPECT_EQ(4, f.capacite());
+	f.enfiler(6);
+	EXPECT_EQ(8, f.capacite());
+	EXPECT_EQ(5, f.taille());
+	for (int i = 0; i < 5; ++i)
+		EXPECT_EQ(i + 2, f[i]);
+	EXPECT_EQ(2, f.premier());
+	EXPECT_EQ(6, f.dernier());
+}
+
+TEST_F(FileAnneauTest, regimePermanentSansCroissance) {
+	FileAnneau<int> f(8);
+	for (int i = 0; i < 4; ++i)
+		f.enfiler(i);
+	for (int i = 4; i < 1000; ++i) {
+		f.enfiler(i);
+		EXPECT_EQ(i - 4, f.defiler());
+	}
+	EXPECT_EQ(8, f.capacite());
+	EXPECT_EQ(4, f.taille());
+}
+
+TEST_F(FileAnneauTest, copieDUnAnneauEnroule) {
+	FileAnneau<int> f(4);
+	for (int i = 0; i < 4; ++i)
+		f.enfiler(i);
+	f.defiler();
+	f.defiler();
+	f.enfiler(4);
+	f.enfiler(5);
+	FileAnneau<int> copie(f);
+	EXPECT_EQ(4, copie.taille());
+	for (int i = 0; i < 4; ++i)
+		EXPECT_EQ(i + 2, copie[i]);
+	file2 = f;
+	EXPECT_EQ(2, file2.premier());
+	EXPECT_EQ(5, file2.dernier());
+}
+
+TEST_F(FileAnneauTest, deplacementRepriseDuTableau) {
+	const int * premier = &file2.premier();
+	FileAnneau<int> deplacee(std::move(file2));
+	EXPECT_EQ(premier, &deplacee.premier());
+	EXPECT_EQ(3, deplacee.taille());
+	EXPECT_EQ(0, file2.taille());
+	EXPECT_EQ(0, file2.capacite());
+
+	file2.enfiler(val1);
+	EXPECT_EQ(val1, file2.premier());
+	EXPECT_EQ(16, file2.capacite());
+
+	file1 = std::move(deplacee);
+	EXPECT_EQ(premier, &file1.premier());
+	FileAnneau<int> copie(deplacee);
+	EXPECT_TRUE(copie.estVide());
+}
@@ -0,0 +1,141 @@
+/**
+ * \file FileBloquanteTesteur.cpp
+ * \brief Tests de la classe FileBloquante en format Google Test
+ * \version 0.1
+ *
+ * Attentes, délais, fermeture et contre-pression
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileBloquante.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+static const int NB_ELEMENTS = 20000;
+
+class FileBloquanteTest: public ::testing::Test {
+public:
+	FileBloquanteTest() :
+		file1(2) {
+	}
+	FileBloquante<int> file1;
+};
+
+TEST_F(FileBloquanteTest, FileVideOK) {
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+	EXPECT_FALSE(file1.estFermee());
+}
+
+TEST_F(FileBloquanteTest, DefilerAvecDelaiExpireSurFileVide) {
+	int el = 0;
+	std::chrono::steady_clock::time_point debut = std::chrono::steady_clock::now();
+	EXPECT_FALSE(file1.defiler(el, std::chrono::milliseconds(20)));
+	EXPECT_GE(std::chrono::steady_clock::now() - debut, std::chrono::milliseconds(20));
+}
+
+TEST_F(FileBloquanteTest, EnfilerAvecDelaiExpireSurFilePleine) {
+	EXPECT_TRUE(file1.enfiler(1));
+	EXPECT_TRUE(file1.enfiler(2, std::chrono::milliseconds(0)));
+	EXPECT_FALSE(file1.enfiler(3, std::chrono::milliseconds(10)));
+	EXPECT_EQ(2, file1.taille());
+	int el = 0;
+	EXPECT_TRUE(file1.defiler(el));
+	EXPECT_EQ(1, el);
+}
+
+TEST_F(FileBloquanteTest, DefilerAttendUnProducteur) {
+	std::thread producteur([this]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		file1.enfiler(42);
+	});
+	int el = 0;
+	EXPECT_TRUE(file1.defiler(el));
+	EXPECT_EQ(42, el);
+	producteur.join();
+}
+
+TEST_F(FileBloquanteTest, EnfilerBloqueJusquAUnDefiler) {
+	file1.enfiler(1);
+	file1.enfiler(2);
+	std::thread producteur([this]() {
+		file1.enfiler(3);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	EXPECT_EQ(2, file1.taille());
+	int el = 0;
+	EXPECT_TRUE(file1.defiler(el));
+	producteur.join();
+	EXPECT_TRUE(file1.defiler(el));
+	EXPECT_EQ(2, el);
+	EXPECT_TRUE(file1.defiler(el));
+	EXPECT_EQ(3, el);
+}
+
+TEST_F(FileBloquanteTest, FermerReveilleLesConsommateursEtVideLeReste) {
+	std::vector<std::thread> consommateurs;
+	std::vector<char> resultats(3, true);
+	for (int c = 0; c < 3; ++c) {
+		consommateurs.push_back(std::thread([this, c, &resultats]() {
+			int el;
+			resultats[c] = file1.defiler(el);
+		}));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	file1.fermer();
+	for (std::size_t c = 0; c < consommateurs.size(); ++c)
+		consommateurs[c].join();
+	for (int c = 0; c < 3; ++c)
+		EXPECT_FALSE(resultats[c]);
+
+	FileBloquante<int> f(4);
+	f.enfiler(7);
+	f.fermer();
+	EXPECT_TRUE(f.estFermee());
+	EXPECT_FALSE(f.enfiler(8));
+	int el = 0;
+	EXPECT_TRUE(f.defiler(el));
+	EXPECT_EQ(7, el);
+	EXPECT_FALSE(f.defiler(el));
+}
+
+TEST_F(FileBloquanteTest, FermerReveilleUnProducteurBloque) {
+	file1.enfiler(1);
+	file1.enfiler(2);
+	bool resultat = true;
+	std::thread producteur([this, &resultat]() {
+		resultat = file1.enfiler(3);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	file1.fermer();
+	producteur.join();
+	EXPECT_FALSE(resultat);
+}
+
+TEST_F(FileBloquanteTest, PlusieursProducteursEtConsommateursAvecSondage) {
+	FileBloquante<int> canal(16, 100);
+	std::vector<long long> sommes(2, 0);
+	std::vector<std::thread> fils;
+	for (int p = 0; p < 2; ++p) {
+		fils.push_back(std::thread([&canal]() {
+			for (int i = 1; i <= NB_ELEMENTS; ++i)
+				canal.enfiler(i);
+		}));
+	}
+	for (int c = 0; c < 2; ++c) {
+		fils.push_back(std::thread([&canal, &sommes, c]() {
+			int el;
+			while (canal.defiler(el))
+				sommes[c] += el;
+		}));
+	}
+	fils[0].join();
+	fils[1].join();
+	canal.fermer();
+	fils[2].join();
+	fils[3].join();
+	EXPECT_EQ(2LL * NB_ELEMENTS * (NB_ELEMENTS + 1) / 2, sommes[0] + sommes[1]);
+}
@@ -0,0 +1,135 @@
+/**
+ * \file FileDePrioriteTesteur.cpp
+ * \brief Tests de la classe FileDePriorite en format Google Test
+ * \version 0.1
+ *
+ * Représentation dans un monceau 4-aire implicite
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileDePriorite.h"
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace lab04;
+static const int val1 = 10;
+static const int val2 = 20;
+static const int val3 = 30;
+
+class FileDePrioriteTest: public ::testing::Test {
+public:
+	virtual void SetUp() {
+		poignee2 = file2.enfiler(val2);
+		poignee3 = file2.enfiler(val3);
+		poignee1 = file2.enfiler(val1);
+	}
+	// virtual void TearDown() {}
+	FileDePriorite<int> file1;
+	FileDePriorite<int> file2;
+	FileDePriorite<int>::Poignee poignee1;
+	FileDePriorite<int>::Poignee poignee2;
+	FileDePriorite<int>::Poignee poignee3;
+};
+
+TEST_F(FileDePrioriteTest, FileVideOK) {
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+	EXPECT_THROW(file1.premier(), PreconditionException);
+	EXPECT_THROW(file1.defiler(), PreconditionException);
+}
+
+TEST_F(FileDePrioriteTest, EnfileUnElementOK) {
+	FileDePriorite<int>::Poignee p = file1.enfiler(val1);
+	EXPECT_TRUE(file1.contient(p));
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_EQ(1, file1.taille());
+	EXPECT_EQ(val1, file1.defiler());
+	EXPECT_FALSE(file1.contient(p));
+	EXPECT_TRUE(file1.estVide());
+}
+
+TEST_F(FileDePrioriteTest, DefileParOrdreDePriorite) {
+	EXPECT_EQ(val1, file2.premier());
+	EXPECT_EQ(val1, file2.defiler());
+	EXPECT_EQ(val2, file2.defiler());
+	EXPECT_EQ(val3, file2.defiler());
+	EXPECT_TRUE(file2.estVide());
+}
+
+TEST_F(FileDePrioriteTest, ComparateurInverse) {
+	FileDePriorite<int, std::greater<int> > f;
+	f.enfiler(val2);
+	f.enfiler(val3);
+	f.enfiler(val1);
+	EXPECT_EQ(val3, f.defiler());
+	EXPECT_EQ(val2, f.defiler());
+	EXPECT_EQ(val1, f.defiler());
+}
+
+TEST_F(FileDePrioriteTest, diminuerCleRemonteLElement) {
+	EXPECT_EQ(val3, file2.element(poignee3));
+	file2.diminuerCle(poignee3, 5);
+	EXPECT_EQ(5, file2.element(poignee3));
+	EXPECT_EQ(5, file2.defiler());
+	EXPECT_EQ(val1, file2.defiler());
+	EXPECT_EQ(val2, file2.defiler());
+}
+
+TEST_F(FileDePrioriteTest, diminuerCleErreur) {
+	EXPECT_THROW(file2.diminuerCle(poignee1, val1 + 1), PreconditionException);
+	EXPECT_THROW(file2.diminuerCle(-1, 0), PreconditionException);
+	EXPECT_THROW(file2.diminuerCle(42, 0), PreconditionException);
+	file2.defiler();
+	EXPECT_THROW(file2.diminuerCle(poignee1, 0), PreconditionException);
+	EXPECT_THROW(file2.element(poignee1), PreconditionException);
+}
+
+TEST_F(FileDePrioriteTest, poigneesReutilisees) {
+	file2.defiler();
+	FileDePriorite<int>::Poignee p = file2.enfiler(val3 + 10);
+	EXPECT_EQ(poignee1, p);
+	EXPECT_EQ(val3 + 10, file2.element(p));
+	EXPECT_EQ(val2, file2.element(poignee2));
+	EXPECT_EQ(3, file2.taille());
+}
+
+TEST_F(FileDePrioriteTest, constructionParLot) {
+	std::vector<int> v;
+	for (int i = 0; i < 1000; ++i)
+		v.push_back((i * 7919) % 1000);
+	FileDePriorite<int> f(v.begin(), v.end());
+	EXPECT_EQ(1000, f.taille());
+	for (int i = 0; i < 1000; ++i)
+		EXPECT_EQ(v[i], f.element(i));
+	for (int i = 0; i < 1000; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_TRUE(f.estVide());
+}
+
+TEST_F(FileDePrioriteTest, trieUneSequenceAvecDiminutions) {
+	FileDePriorite<int> f;
+	std::vector<FileDePriorite<int>::Poignee> poignees;
+	std::vector<int> attendu;
+	for (int i = 0; i < 500; ++i)
+		poignees.push_back(f.enfiler(10000 + (i * 37) % 500));
+	for (int i = 0; i < 500; i += 3)
+		f.diminuerCle(poignees[i], f.element(poignees[i]) - 10000 + (i % 7));
+	for (int i = 0; i < 500; ++i)
+		attendu.push_back(f.element(poignees[i]));
+	std::sort(attendu.begin(), attendu.end());
+	for (int i = 0; i < 500; ++i)
+		EXPECT_EQ(attendu[i], f.defiler());
+}
+
+TEST_F(FileDePrioriteTest, elementsNonTriviaux) {
+	FileDePriorite<std::string> f;
+	f.enfiler("moyen");
+	FileDePriorite<std::string>::Poignee p = f.enfiler("zzz");
+	f.enfiler("bas");
+	f.diminuerCle(p, "aaa");
+	EXPECT_EQ("aaa", f.defiler());
+	EXPECT_EQ("bas", f.defiler());
+	EXPECT_EQ("moyen", f.defiler());
+}
@@ -0,0 +1,134 @@
+/**
+ * \file FileDebordanteTesteur.cpp
+ * \brief Tests de la classe FileDebordante en format Google Test
+ * \version 0.1
+ *
+ * File bornée en mémoire qui déborde dans des fichiers de segment
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileDebordante.h"
+#include <cstdio>
+#include <string>
+
+using namespace lab04;
+
+static const char * const prefixe = "fileDebordanteTest";
+
+static bool segmentExiste(int p_numero)
+{
+	std::FILE * fichier = std::fopen((std::string(prefixe) + "." + std::to_string(p_numero)).c_str(), "rb");
+	if (fichier == 0)
+		return false;
+	std::fclose(fichier);
+	return true;
+}
+
+TEST(FileDebordanteTest, FileVideOK) {
+	FileDebordante<int> f(prefixe, 8, 4);
+	EXPECT_TRUE(f.estVide());
+	EXPECT_EQ(0, f.taille());
+	EXPECT_EQ(0, f.nombreSegments());
+	EXPECT_THROW(f.defiler(), PreconditionException);
+}
+
+TEST(FileDebordanteTest, parametresInvalides) {
+	EXPECT_THROW(FileDebordante<int> f(prefixe, 8, 0), PreconditionException);
+	EXPECT_THROW(FileDebordante<int> f(prefixe, 4, 8), PreconditionException);
+	EXPECT_THROW(FileDebordante<int> f(prefixe, 4, 4), PreconditionException);
+}
+
+TEST(FileDebordanteTest, resteEnMemoireSansDebordement) {
+	FileDebordante<int> f(prefixe, 8, 4);
+	for (int i = 0; i < 8; ++i)
+		f.enfiler(i);
+	EXPECT_EQ(0, f.nombreSegments());
+	for (int i = 0; i < 8; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_TRUE(f.estVide());
+}
+
+TEST(FileDebordanteTest, debordeParSegmentsEtConserveLOrdre) {
+	FileDebordante<int> f(prefixe, 8, 4);
+	for (int i = 0; i < 8 + 4 * 3 + 2; ++i)
+		f.enfiler(i);
+	EXPECT_EQ(22, f.taille());
+	EXPECT_EQ(3, f.nombreSegments());
+	EXPECT_TRUE(segmentExiste(0));
+	EXPECT_TRUE(segmentExiste(2));
+	EXPECT_FALSE(segmentExiste(3));
+
+	for (int i = 0; i < 8; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_EQ(2, f.nombreSegments());
+	EXPECT_FALSE(segmentExiste(0));
+	EXPECT_TRUE(segmentExiste(1));
+	for (int i = 8; i < 22; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_TRUE(f.estVide());
+	EXPECT_FALSE(segmentExiste(2));
+}
+
+TEST(FileDebordanteTest, enfilerEtDefilerEntrelaces) {
+	FileDebordante<long long> f(prefixe, 16, 8, FileDebordante<long long>::SYNCHRO_PAR_SEGMENT);
+	long long prochain = 0;
+	long long attendu = 0;
+	for (int tour = 0; tour < 50; ++tour)
+	{
+		for (int i = 0; i < 40; ++i)
+			f.enfiler(prochain++);
+		for (int i = 0; i < 30; ++i)
+			EXPECT_EQ(attendu++, f.defiler());
+		EXPECT_EQ(prochain - attendu, f.taille());
+	}
+	while (!f.estVide())
+		EXPECT_EQ(attendu++, f.defiler());
+	EXPECT_EQ(prochain, attendu);
+	EXPECT_EQ(0, f.nombreSegments());
+}
+
+TEST(FileDebordanteTest, destructeurEffaceLesSegments) {
+	{
+		FileDebordante<int> f(prefixe, 4, 2);
+		for (int i = 0; i < 20; ++i)
+			f.enfiler(i);
+		EXPECT_EQ(8, f.nombreSegments());
+		EXPECT_TRUE(segmentExiste(7));
+	}
+	for (int i = 0; i < 8; ++i)
+		EXPECT_FALSE(segmentExiste(i));
+}
+
+TEST(FileDebordanteTest, repertoireInexistantLanceRuntimeError) {
+	FileDebordante<int> f("repertoire/inexistant/file", 3, 2);
+	for (int i = 0; i < 4; ++i)
+		f.enfiler(i);
+	EXPECT_THROW(f.enfiler(4), std::runtime_error);
+	EXPECT_EQ(4, f.taille());
+
+	EXPECT_THROW(f.enfiler(4), std::runtime_error);
+	EXPECT_EQ(4, f.taille());
+	for (int i = 0; i < 4; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_TRUE(f.estVide());
+}
+
+TEST(FileDebordanteTest, segmentManquantNePerdAucunElement) {
+	const std::string nom = std::string(prefixe) + ".0";
+	const std::string deplace = nom + ".deplace";
+	FileDebordante<int> f(prefixe, 3, 2);
+	for (int i = 0; i < 5; ++i)
+		f.enfiler(i);
+	EXPECT_EQ(1, f.nombreSegments());
+	EXPECT_EQ(0, f.defiler());
+	EXPECT_EQ(1, f.defiler());
+
+	ASSERT_EQ(0, std::rename(nom.c_str(), deplace.c_str()));
+	EXPECT_THROW(f.defiler(), std::runtime_error);
+	EXPECT_EQ(3, f.taille());
+
+	ASSERT_EQ(0, std::rename(deplace.c_str(), nom.c_str()));
+	for (int i = 2; i < 5; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_TRUE(f.estVide());
+}
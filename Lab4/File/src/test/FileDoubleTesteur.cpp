@@ -0,0 +1,121 @@
+/**
+ * \file FileDoubleTesteur.cpp
+ * \brief Tests de la classe FileDouble en format Google Test
+ * \version 0.1
+ *
+ * Représentation dans un tableau circulaire extensible, ajout et retrait aux deux bouts
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileDouble.h"
+
+using namespace lab04;
+static const int val1 = 10;
+static const int val2 = 20;
+static const int val3 = 30;
+
+class FileDoubleTest: public ::testing::Test {
+public:
+	virtual void SetUp() {
+		file2.enfiler(val1);
+		file2.enfiler(val2);
+		file2.enfiler(val3);
+	}
+	// virtual void TearDown() {}
+	FileDouble<int> file1;
+	FileDouble<int> file2;
+};
+
+TEST_F(FileDoubleTest, operatorCrochetErreur) {
+	file1.enfiler(5);
+	EXPECT_THROW(file1[-1], PreconditionException);
+	EXPECT_THROW(file1[2], PreconditionException);
+}
+
+TEST_F(FileDoubleTest, copieDUnAnneauEnroule) {
+	FileDouble<int> f(4);
+	for (int i = 0; i < 4; ++i)
+		f.enfiler(i);
+	f.defiler();
+	f.defiler();
+	f.enfiler(4);
+	f.enfiler(5);
+	FileDouble<int> copie(f);
+	EXPECT_EQ(4, copie.taille());
+	for (int i = 0; i < 4; ++i)
+		EXPECT_EQ(i + 2, copie[i]);
+	file2 = f;
+	EXPECT_EQ(2, file2.premier());
+	EXPECT_EQ(5, file2.dernier());
+}
+
+TEST_F(FileDoubleTest, enfilerEnTeteEtDefilerEnQueue) {
+	file1.enfilerEnTete(val2);
+	file1.enfilerEnTete(val1);
+	file1.enfiler(val3);
+	EXPECT_EQ(val1, file1.premier());
+	EXPECT_EQ(val3, file1.dernier());
+	EXPECT_EQ(val3, file1.defilerEnQueue());
+	EXPECT_EQ(val2, file1.defilerEnQueue());
+	EXPECT_EQ(val1, file1.defilerEnQueue());
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_THROW(file1.defilerEnQueue(), PreconditionException);
+}
+
+TEST_F(FileDoubleTest, enfilerEnTeteRevientALaFinDuTableau) {
+	FileDouble<int> f(4);
+	f.enfilerEnTete(1);
+	f.enfilerEnTete(0);
+	f.enfiler(2);
+	f.enfiler(3);
+	EXPECT_EQ(4, f.capacite());
+	for (int i = 0; i < 4; ++i)
+		EXPECT_EQ(i, f[i]);
+	f.enfilerEnTete(-1);
+	EXPECT_EQ(8, f.capacite());
+	for (int i = 0; i < 5; ++i)
+		EXPECT_EQ(i - 1, f[i]);
+}
+
+TEST_F(FileDoubleTest, operatorCrochetModifieEnPlace) {
+	file2.defiler();
+	file2.enfilerEnTete(5);
+	file2[1] += 1;
+	EXPECT_EQ(5, file2[0]);
+	EXPECT_EQ(val2 + 1, file2[1]);
+	EXPECT_THROW(file2[3] = 0, PreconditionException);
+}
+
+TEST_F(FileDoubleTest, maximumSurFenetreGlissante) {
+	const int valeurs[] = { 1, 3, -1, -3, 5, 3, 6, 7 };
+	const int attendus[] = { 3, 3, 5, 5, 6, 7 };
+	const int largeur = 3;
+	FileDouble<int> indices;
+	for (int i = 0; i < 8; ++i) {
+		while (!indices.estVide() && indices.premier() <= i - largeur)
+			indices.defiler();
+		while (!indices.estVide() && valeurs[indices.dernier()] <= valeurs[i])
+			indices.defilerEnQueue();
+		indices.enfiler(i);
+		if (i >= largeur - 1) {
+			EXPECT_EQ(attendus[i - largeur + 1], valeurs[indices.premier()]);
+		}
+	}
+}
+
+TEST_F(FileDoubleTest, deplacementRepriseDuTableau) {
+	const int * premier = &file2.premier();
+	FileDouble<int> deplacee(std::move(file2));
+	EXPECT_EQ(premier, &deplacee.premier());
+	EXPECT_EQ(3, deplacee.taille());
+	EXPECT_EQ(0, file2.taille());
+	EXPECT_EQ(0, file2.capacite());
+
+	file2.enfilerEnTete(val1);
+	EXPECT_EQ(val1, file2.premier());
+
+	file1 = std::move(deplacee);
+	EXPECT_EQ(premier, &file1.premier());
+	FileDouble<int> copie(deplacee);
+	EXPECT_TRUE(copie.estVide());
+}
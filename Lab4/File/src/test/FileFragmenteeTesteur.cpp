@@ -0,0 +1,124 @@
+/**
+ * \file FileFragmenteeTesteur.cpp
+ * \brief Tests de la classe FileFragmentee en format Google Test
+ * \version 0.1
+ *
+ * Une File et un mutex par fragment, un fragment par fil producteur
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileFragmentee.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+TEST(FileFragmenteeTest, FileVideOK) {
+	FileFragmentee<int> f(8, 4);
+	EXPECT_TRUE(f.estVide());
+	EXPECT_EQ(4, f.nombreFragments());
+	int el = 0;
+	EXPECT_FALSE(f.defiler(el));
+	EXPECT_GE(FileFragmentee<int>().nombreFragments(), 1);
+}
+
+TEST(FileFragmenteeTest, parametresInvalides) {
+	EXPECT_THROW(FileFragmentee<int> f(0, 2), PreconditionException);
+	EXPECT_THROW(FileFragmentee<int> f(8, -1), PreconditionException);
+}
+
+TEST(FileFragmenteeTest, unSeulFilGardeLOrdre) {
+	FileFragmentee<int> f(8, 4);
+	for (int i = 0; i < 8; ++i)
+		EXPECT_TRUE(f.enfiler(i));
+	EXPECT_EQ(8, f.taille());
+	int el = -1;
+	for (int i = 0; i < 8; ++i) {
+		EXPECT_TRUE(f.defiler(el));
+		EXPECT_EQ(i, el);
+	}
+	EXPECT_TRUE(f.estVide());
+}
+
+TEST(FileFragmenteeTest, fragmentPleinSelonLAffectation) {
+	FileFragmentee<int> fixe(2, 3, FileFragmentee<int>::PAR_PRODUCTEUR);
+	EXPECT_TRUE(fixe.enfiler(1));
+	EXPECT_TRUE(fixe.enfiler(2));
+	EXPECT_FALSE(fixe.enfiler(3));
+
+	FileFragmentee<int> libre(2, 3, FileFragmentee<int>::LIBRE);
+	for (int i = 0; i < 6; ++i)
+		EXPECT_TRUE(libre.enfiler(i));
+	EXPECT_FALSE(libre.enfiler(6));
+	EXPECT_EQ(6, libre.taille());
+	int el = 0;
+	int somme = 0;
+	while (libre.defiler(el))
+		somme += el;
+	EXPECT_EQ(15, somme);
+}
+
+TEST(FileFragmenteeTest, ordreParProducteurAvecUnConsommateur) {
+	const int producteurs = 4;
+	const int parProducteur = 5000;
+	FileFragmentee<int> f(64, 3);
+	std::vector<std::thread> fils;
+	for (int p = 0; p < producteurs; ++p) {
+		fils.push_back(std::thread([&f, p]() {
+			for (int i = 0; i < parProducteur; ++i)
+				while (!f.enfiler(p * parProducteur + i))
+					std::this_thread::yield();
+		}));
+	}
+
+	std::vector<int> derniers(producteurs, -1);
+	bool ordonne = true;
+	int el = 0;
+	for (int recus = 0; recus < producteurs * parProducteur;) {
+		if (!f.defiler(el)) {
+			std::this_thread::yield();
+			continue;
+		}
+		const int p = el / parProducteur;
+		ordonne = ordonne && el % parProducteur > derniers[p];
+		derniers[p] = el % parProducteur;
+		++recus;
+	}
+	for (size_t i = 0; i < fils.size(); ++i)
+		fils[i].join();
+	EXPECT_TRUE(ordonne);
+	EXPECT_TRUE(f.estVide());
+}
+
+TEST(FileFragmenteeTest, plusieursProducteursEtConsommateurs) {
+	const int nombreFils = 4;
+	const int parProducteur = 5000;
+	FileFragmentee<int> f(32, 2, FileFragmentee<int>::LIBRE);
+	std::vector<char> vus(nombreFils * parProducteur, 0);
+	std::atomic<int> restants(nombreFils * parProducteur);
+	std::vector<std::thread> fils;
+	for (int p = 0; p < nombreFils; ++p) {
+		fils.push_back(std::thread([&f, p]() {
+			for (int i = 0; i < parProducteur; ++i)
+				while (!f.enfiler(p * parProducteur + i))
+					std::this_thread::yield();
+		}));
+		fils.push_back(std::thread([&f, &vus, &restants]() {
+			int el = 0;
+			while (restants.load() > 0) {
+				if (f.defiler(el)) {
+					vus[el] = 1;
+					restants.fetch_sub(1);
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+	for (size_t i = 0; i < fils.size(); ++i)
+		fils[i].join();
+	for (size_t i = 0; i < vus.size(); ++i)
+		ASSERT_EQ(1, vus[i]);
+	EXPECT_TRUE(f.estVide());
+}
@@ -0,0 +1,132 @@
+/**
+ * \file FileInstrumenteeTesteur.cpp
+ * \brief Tests des classes FileInstrumentee et TelemetrieFile en format Google Test
+ * \version 0.1
+ *
+ * File dont les éléments sont horodatés, et compteurs d'activité
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileInstrumentee.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace lab04;
+
+TEST(FileInstrumenteeTest, FileVideOK) {
+	FileInstrumentee<int> f(4);
+	EXPECT_TRUE(f.estVide());
+	EXPECT_EQ(0u, f.telemetrie().enfilements());
+	EXPECT_EQ(0u, f.telemetrie().attente(0.5));
+	EXPECT_THROW(f.defiler(), PreconditionException);
+}
+
+TEST(FileInstrumenteeTest, compteursEtEvenements) {
+	FileInstrumentee<int> f(3);
+	for (int tour = 0; tour < 2; ++tour) {
+		f.enfiler(1);
+		f.enfiler(2);
+		f.enfiler(3);
+		EXPECT_TRUE(f.estPleine());
+		EXPECT_EQ(1, f.premier());
+		EXPECT_EQ(3, f.dernier());
+		EXPECT_EQ(1, f.defiler());
+		EXPECT_EQ(2, f.defiler());
+		EXPECT_EQ(3, f.defiler());
+	}
+	f.enfiler(4);
+	const TelemetrieFile & t = f.telemetrie();
+	EXPECT_EQ(7u, t.enfilements());
+	EXPECT_EQ(6u, t.defilements());
+	EXPECT_EQ(3, t.tailleMaximale());
+	EXPECT_EQ(2u, t.evenementsPleine());
+	EXPECT_EQ(2u, t.evenementsVide());
+	EXPECT_GT(t.debitEnfilement(), 0);
+	f.enfiler(5);
+	f.enfiler(6);
+	EXPECT_THROW(f.enfiler(7), PreconditionException);
+	EXPECT_EQ(9u, t.enfilements());
+}
+
+TEST(FileInstrumenteeTest, reinitialiser) {
+	FileInstrumentee<int> f(3);
+	f.enfiler(1);
+	f.defiler();
+	f.telemetrie().reinitialiser();
+	EXPECT_EQ(0u, f.telemetrie().enfilements());
+	EXPECT_EQ(0u, f.telemetrie().defilements());
+	EXPECT_EQ(0, f.telemetrie().tailleMaximale());
+	EXPECT_EQ(0u, f.telemetrie().attente(1));
+}
+
+TEST(FileInstrumenteeTest, attenteMesuree) {
+	FileInstrumentee<int> f(3);
+	f.enfiler(1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	f.defiler();
+	const std::uint64_t attente = f.telemetrie().attente(0.5);
+	EXPECT_GE(attente, 20000000u);
+	EXPECT_LT(attente, 5000000000u);
+}
+
+TEST(FileInstrumenteeTest, echantillonnageDesAttentes) {
+	FileInstrumentee<int> f(8, 4);
+	for (int i = 0; i < 8; ++i)
+		f.enfiler(i);
+	for (int i = 0; i < 8; ++i)
+		EXPECT_EQ(i, f.defiler());
+	EXPECT_EQ(8u, f.telemetrie().defilements());
+	EXPECT_EQ(1u, f.telemetrie().evenementsVide());
+	EXPECT_GT(f.telemetrie().attente(1), 0u);
+	EXPECT_THROW(FileInstrumentee<int> invalide(8, 0), PreconditionException);
+}
+
+TEST(FileInstrumenteeTest, quantilesDeLHistogramme) {
+	TelemetrieFile t;
+	for (std::uint64_t v = 1; v <= 1000; ++v)
+		t.noterDefilement(1, v);
+	EXPECT_EQ(1u, t.attente(0));
+	const std::uint64_t mediane = t.attente(0.5);
+	EXPECT_GE(mediane, 500u);
+	EXPECT_LE(mediane, 500u + 500u / 8);
+	const std::uint64_t p99 = t.attente(0.99);
+	EXPECT_GE(p99, 990u);
+	EXPECT_LE(p99, 990u + 990u / 8);
+	EXPECT_GE(t.attente(1), 1000u);
+	EXPECT_THROW(t.attente(1.5), PreconditionException);
+
+	t.noterDefilement(0, ~std::uint64_t(0));
+	EXPECT_EQ(~std::uint64_t(0), t.attente(1));
+}
+
+TEST(FileInstrumenteeTest, lectureConcurrente) {
+	TelemetrieFile t;
+	std::atomic<bool> fini(false);
+	std::thread lecteur([&t, &fini]() {
+		std::uint64_t precedent = 0;
+		while (!fini.load()) {
+			const std::uint64_t courant = t.enfilements();
+			EXPECT_GE(courant, precedent);
+			precedent = courant;
+			t.attente(0.9);
+			std::this_thread::yield();
+		}
+	});
+	std::thread ecrivains[2];
+	for (int e = 0; e < 2; ++e) {
+		ecrivains[e] = std::thread([&t]() {
+			for (int i = 1; i <= 20000; ++i) {
+				t.noterEnfilement(i, false);
+				t.noterDefilement(i, static_cast<std::uint64_t>(i));
+			}
+		});
+	}
+	for (int e = 0; e < 2; ++e)
+		ecrivains[e].join();
+	fini.store(true);
+	lecteur.join();
+	EXPECT_EQ(40000u, t.enfilements());
+	EXPECT_EQ(40000u, t.defilements());
+	EXPECT_EQ(20000, t.tailleMaximale());
+}
@@ -0,0 +1,120 @@
+/**
+ * \file FileMPMCTesteur.cpp
+ * \brief Tests de la classe FileMPMC en format Google Test
+ * \version 0.1
+ *
+ * Plusieurs producteurs et consommateurs dans des fils distincts
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileMPMC.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+static const int NB_PRODUCTEURS = 4;
+static const int NB_CONSOMMATEURS = 4;
+static const int NB_PAR_PRODUCTEUR = 50000;
+
+class FileMPMCTest: public ::testing::Test {
+public:
+	FileMPMCTest() :
+		file1(4) {
+	}
+	FileMPMC<int> file1;
+};
+
+TEST_F(FileMPMCTest, FileVideOK) {
+	int el = 0;
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+	EXPECT_EQ(4, file1.capacite());
+	EXPECT_FALSE(file1.defiler(el));
+}
+
+TEST_F(FileMPMCTest, OrdreFIFOEtFilePleine) {
+	int el = 0;
+	for (int i = 1; i <= 4; ++i)
+		EXPECT_TRUE(file1.enfiler(i));
+	EXPECT_FALSE(file1.enfiler(5));
+	EXPECT_EQ(4, file1.taille());
+	for (int tour = 0; tour < 10; ++tour) {
+		EXPECT_TRUE(file1.defiler(el));
+		EXPECT_EQ(tour + 1, el);
+		EXPECT_TRUE(file1.enfiler(tour + 5));
+	}
+	while (file1.defiler(el)) {
+	}
+	EXPECT_EQ(14, el);
+	EXPECT_TRUE(file1.estVide());
+}
+
+TEST_F(FileMPMCTest, CapaciteArrondieAPuissanceDe2) {
+	FileMPMC<int> f(3);
+	EXPECT_EQ(4, f.capacite());
+	EXPECT_THROW(FileMPMC<int> invalide(-1), PreconditionException);
+}
+
+TEST_F(FileMPMCTest, DeplacementEtDestructionDesRestants) {
+	std::shared_ptr<int> partage(new int(3));
+	{
+		FileMPMC<std::shared_ptr<int> > pointeurs(2);
+		std::shared_ptr<int> copie(partage);
+		EXPECT_TRUE(pointeurs.enfiler(std::move(copie)));
+		EXPECT_FALSE(copie);
+		EXPECT_TRUE(pointeurs.enfiler(partage));
+		copie = partage;
+		EXPECT_FALSE(pointeurs.enfiler(std::move(copie)));
+		EXPECT_TRUE(copie);
+		EXPECT_EQ(4, partage.use_count());
+	}
+	EXPECT_EQ(1, partage.use_count());
+}
+
+TEST_F(FileMPMCTest, ProducteursEtConsommateursConcurrents) {
+	FileMPMC<int> canal(64);
+	const int total = NB_PRODUCTEURS * NB_PAR_PRODUCTEUR;
+	std::vector<std::atomic<int> > recus(total);
+	for (int i = 0; i < total; ++i)
+		recus[i].store(0);
+	std::atomic<int> nbRecus(0);
+
+	std::vector<std::thread> fils;
+	for (int p = 0; p < NB_PRODUCTEURS; ++p) {
+		fils.push_back(std::thread([&canal, p]() {
+			for (int i = 0; i < NB_PAR_PRODUCTEUR; ++i)
+				while (!canal.enfiler(p * NB_PAR_PRODUCTEUR + i))
+					std::this_thread::yield();
+		}));
+	}
+	std::vector<char> ordreParProducteur(NB_CONSOMMATEURS, true);
+	for (int c = 0; c < NB_CONSOMMATEURS; ++c) {
+		fils.push_back(std::thread([&canal, &recus, &nbRecus, &ordreParProducteur, total, c]() {
+			std::vector<int> dernier(NB_PRODUCTEURS, -1);
+			int el;
+			while (nbRecus.load() < total) {
+				if (canal.defiler(el)) {
+					recus[el].fetch_add(1);
+					nbRecus.fetch_add(1);
+					int producteur = el / NB_PAR_PRODUCTEUR;
+					if (el <= dernier[producteur])
+						ordreParProducteur[c] = false;
+					dernier[producteur] = el;
+				}
+				else
+					std::this_thread::yield();
+			}
+		}));
+	}
+	for (std::size_t i = 0; i < fils.size(); ++i)
+		fils[i].join();
+
+	for (int i = 0; i < total; ++i)
+		EXPECT_EQ(1, recus[i].load()) << "élément " << i;
+	for (int c = 0; c < NB_CONSOMMATEURS; ++c)
+		EXPECT_TRUE(ordreParProducteur[c]);
+	EXPECT_TRUE(canal.estVide());
+}
@@ -0,0 +1,106 @@
+/**
+ * \file FileMiroirTesteur.cpp
+ * \brief Tests de la classe FileMiroir en format Google Test
+ * \version 0.1
+ *
+ * Tableau circulaire projeté deux fois en mémoire virtuelle
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileMiroir.h"
+
+#if defined(__linux__)
+
+#include <cstring>
+#include <string>
+
+using namespace lab04;
+static const int val1 = 10;
+static const int val2 = 20;
+static const int val3 = 30;
+
+class FileMiroirTest: public ::testing::Test {
+public:
+	virtual void SetUp() {
+		file2.enfiler(val1);
+		file2.enfiler(val2);
+		file2.enfiler(val3);
+	}
+	// virtual void TearDown() {}
+	FileMiroir<int> file1;
+	FileMiroir<int> file2;
+};
+
+TEST_F(FileMiroirTest, FileVideOK) {
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+	EXPECT_GE(file1.capacite(), 1024);
+	EXPECT_THROW(file1.defiler(), PreconditionException);
+	EXPECT_THROW(file1.premier(), PreconditionException);
+}
+
+TEST_F(FileMiroirTest, EnfileTroisElementsOK) {
+	EXPECT_EQ(3, file2.taille());
+	EXPECT_EQ(val1, file2.premier());
+	EXPECT_EQ(val2, file2[1]);
+	EXPECT_EQ(val1, file2.defiler());
+	EXPECT_EQ(val2, file2.defiler());
+	EXPECT_EQ(val3, file2.defiler());
+	EXPECT_TRUE(file2.estVide());
+}
+
+TEST_F(FileMiroirTest, capaciteArrondieALaPage) {
+	FileMiroir<char> f(1);
+	EXPECT_EQ(static_cast<int>(sysconf(_SC_PAGESIZE)), f.capacite());
+	EXPECT_THROW(FileMiroir<int> invalide(0), PreconditionException);
+}
+
+TEST_F(FileMiroirTest, zonesContiguesAutourDuRetour) {
+	FileMiroir<char> f(1);
+	const int capacite = f.capacite();
+	for (int i = 0; i < capacite - 3; ++i)
+		f.enfiler('x');
+	f.consommer(capacite - 3);
+
+	int libre = 0;
+	char * ecriture = f.zoneEcriture(libre);
+	EXPECT_EQ(capacite, libre);
+	std::memcpy(ecriture, "bonjour", 7);
+	f.valider(7);
+
+	int presents = 0;
+	const char * lecture = f.zoneLecture(presents);
+	EXPECT_EQ(7, presents);
+	EXPECT_EQ("bonjour", std::string(lecture, presents));
+	EXPECT_EQ('j', f[3]);
+
+	f.consommer(3);
+	lecture = f.zoneLecture(presents);
+	EXPECT_EQ("jour", std::string(lecture, presents));
+	EXPECT_EQ('j', f.defiler());
+}
+
+TEST_F(FileMiroirTest, regimePermanent) {
+	FileMiroir<int> f(1);
+	int attendu = 0;
+	for (int i = 0; i < 10 * f.capacite(); ++i) {
+		f.enfiler(i);
+		if (f.taille() > 100) {
+			EXPECT_EQ(attendu++, f.defiler());
+		}
+	}
+	EXPECT_EQ(attendu, f.premier());
+	EXPECT_EQ(100, f.taille());
+}
+
+TEST_F(FileMiroirTest, validerEtConsommerErreur) {
+	EXPECT_THROW(file2.consommer(4), PreconditionException);
+	EXPECT_THROW(file2.consommer(-1), PreconditionException);
+	EXPECT_THROW(file2.valider(file2.capacite() - 2), PreconditionException);
+	EXPECT_THROW(file2[3], PreconditionException);
+	while (!file2.estPleine())
+		file2.enfiler(0);
+	EXPECT_THROW(file2.enfiler(0), PreconditionException);
+}
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * \file FileSPSCTesteur.cpp
+ * \brief Tests de la classe FileSPSC en format Google Test
+ * \version 0.1
+ *
+ * Un producteur et un consommateur dans des fils distincts
+ */
+
+#include "gtest/gtest.h"
+#include "../main/FileSPSC.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+static const int NB_ELEMENTS = 1000000;
+
+class FileSPSCTest: public ::testing::Test {
+public:
+	FileSPSCTest() :
+		file1(4) {
+	}
+	FileSPSC<int> file1;
+};
+
+TEST_F(FileSPSCTest, FileVideOK) {
+	int el = 0;
+	EXPECT_TRUE(file1.estVide());
+	EXPECT_EQ(0, file1.taille());
+	EXPECT_EQ(4, file1.capacite());
+	EXPECT_FALSE(file1.defiler(el));
+}
+
+TEST_F(FileSPSCTest, OrdreFIFOEtFilePleine) {
+	int el = 0;
+	for (int i = 1; i <= 4; ++i)
+		EXPECT_TRUE(file1.enfiler(i));
+	EXPECT_FALSE(file1.enfiler(5));
+	EXPECT_EQ(4, file1.taille());
+	for (int tour = 0; tour < 10; ++tour) {
+		EXPECT_TRUE(file1.defiler(el));
+		EXPECT_EQ(tour + 1, el);
+		EXPECT_TRUE(file1.enfiler(tour + 5));
+	}
+	EXPECT_EQ(4, file1.taille());
+}
+
+TEST_F(FileSPSCTest, CapaciteArrondieAPuissanceDe2) {
+	FileSPSC<int> f(100);
+	EXPECT_EQ(128, f.capacite());
+	EXPECT_THROW(FileSPSC<int> invalide(0), PreconditionException);
+}
+
+TEST_F(FileSPSCTest, DeplacementEtDestructionDesRestants) {
+	std::shared_ptr<int> partage(new int(3));
+	{
+		FileSPSC<std::shared_ptr<int> > pointeurs(8);
+		std::shared_ptr<int> copie(partage);
+		EXPECT_TRUE(pointeurs.enfiler(std::move(copie)));
+		EXPECT_FALSE(copie);
+		EXPECT_TRUE(pointeurs.enfiler(partage));
+		EXPECT_EQ(3, partage.use_count());
+		std::shared_ptr<int> recu;
+		EXPECT_TRUE(pointeurs.defiler(recu));
+		EXPECT_EQ(3, partage.use_count());
+	}
+	EXPECT_EQ(1, partage.use_count());
+}
+
+TEST_F(FileSPSCTest, ProducteurEtConsommateurConcurrents) {
+	FileSPSC<int> canal(64);
+	std::thread producteur([&canal]() {
+		for (int i = 0; i < NB_ELEMENTS; ++i)
+			while (!canal.enfiler(i))
+				std::this_thread::yield();
+	});
+
+	int attendu = 0;
+	bool ordreRespecte = true;
+	while (attendu < NB_ELEMENTS) {
+		int el;
+		if (canal.defiler(el)) {
+			ordreRespecte = ordreRespecte && el == attendu;
+			++attendu;
+		}
+		else
+			std::this_thread::yield();
+	}
+	producteur.join();
+	EXPECT_TRUE(ordreRespecte);
+	EXPECT_TRUE(canal.estVide());
+}
+
+TEST_F(FileSPSCTest, ChainesTransmisesIntactes) {
+	FileSPSC<std::string> canal(16);
+	std::thread producteur([&canal]() {
+		for (int i = 0; i < 10000; ++i) {
+			std::string message = "paquet " + std::to_string(i);
+			while (!canal.enfiler(std::move(message)))
+				std::this_thread::yield();
+		}
+	});
+
+	std::vector<std::string> recus;
+	std::string message;
+	while (recus.size() < 10000u)
+		if (canal.defiler(message))
+			recus.push_back(message);
+		else
+			std::this_thread::yield();
+	producteur.join();
+	EXPECT_EQ("paquet 0", recus.front());
+	EXPECT_EQ("paquet 9999", recus.back());
+}
@@ -11,7 +11,10 @@
 
 #include "gtest/gtest.h"
 #include "../main/File.h"
+#include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 using namespace lab04;
 static const int val1 = 10;
@@ -99,8 +102,138 @@ TEST_F(FileTest, operatorCrochetErreur) {
 	EXPECT_THROW(file1[2], PreconditionException);
 }
 
+TEST_F(FileTest, operatorCrochetApresRetour) {
+	File<int> f(3);
+	f.enfiler(1);
+	f.enfiler(2);
+	f.enfiler(3);
+	f.defiler();
+	f.defiler();
+	f.enfiler(4);
+	f.enfiler(5);
+
+	EXPECT_EQ(3, f[0]);
+	EXPECT_EQ(4, f[1]);
+	EXPECT_EQ(5, f[2]);
+	EXPECT_THROW(f[3], PreconditionException);
+}
+
 TEST_F(FileTest, operatorCrochetOk) {
 	EXPECT_EQ(val1, file2[0]);
 	EXPECT_EQ(val2, file2[1]);
 	EXPECT_EQ(val3, file2[2]);
 }
+
+TEST_F(FileTest, enfilerNEtDefilerNAutourDuRetour) {
+	File<int> f(8);
+	for (int i = 0; i < 6; ++i)
+		f.enfiler(i);
+	int sortie[8];
+	EXPECT_EQ(5, f.defilerN(sortie, 5));
+	for (int i = 0; i < 5; ++i)
+		EXPECT_EQ(i, sortie[i]);
+
+	const int bloc[] = { 10, 11, 12, 13, 14, 15 };
+	f.enfilerN(bloc, bloc + 6);
+	EXPECT_EQ(7, f.taille());
+	EXPECT_EQ(5, f.premier());
+	EXPECT_EQ(15, f.dernier());
+
+	EXPECT_EQ(7, f.defilerN(sortie, 8));
+	EXPECT_EQ(5, sortie[0]);
+	for (int i = 1; i < 7; ++i)
+		EXPECT_EQ(9 + i, sortie[i]);
+	EXPECT_TRUE(f.estVide());
+	EXPECT_EQ(0, f.defilerN(sortie, 8));
+}
+
+TEST_F(FileTest, enfilerNDepuisUnIterateurQuelconque) {
+	File<std::string> f(4);
+	f.enfiler("a");
+	f.enfiler("b");
+	f.defiler();
+	std::list<std::string> mots;
+	mots.push_back("c");
+	mots.push_back("d");
+	mots.push_back("e");
+	f.enfilerN(mots.begin(), mots.end());
+	EXPECT_EQ(4, f.taille());
+
+	std::vector<std::string> recus;
+	EXPECT_EQ(4, f.defilerN(std::back_inserter(recus), 10));
+	EXPECT_EQ("b", recus[0]);
+	EXPECT_EQ("e", recus[3]);
+}
+
+TEST_F(FileTest, enfilerNTropGrandLanceLogicError) {
+	File<int> f(4);
+	const int bloc[] = { 1, 2, 3, 4, 5 };
+	EXPECT_THROW(f.enfilerN(bloc, bloc + 5), PreconditionException);
+	f.enfilerN(bloc, bloc + 4);
+	EXPECT_TRUE(f.estPleine());
+	int sortie[1];
+	EXPECT_THROW(f.defilerN(sortie, -1), PreconditionException);
+}
+
+TEST_F(FileTest, copieAutourDuRetourRameneLaTeteAZero) {
+	File<std::string> f(4);
+	f.enfiler("a");
+	f.enfiler("b");
+	f.enfiler("c");
+	f.defiler();
+	f.defiler();
+	f.enfiler("d");
+	f.enfiler("e");
+
+	File<std::string> copie(f);
+	EXPECT_EQ(3, copie.taille());
+	EXPECT_EQ("c", copie[0]);
+	EXPECT_EQ("d", copie[1]);
+	EXPECT_EQ("e", copie[2]);
+	copie.enfiler("f");
+	EXPECT_TRUE(copie.estPleine());
+	EXPECT_EQ("f", copie.dernier());
+	EXPECT_EQ(3, f.taille());
+
+	File<std::string> autre(2);
+	autre = copie;
+	EXPECT_EQ(4, autre.taille());
+	EXPECT_EQ("c", autre.premier());
+	EXPECT_EQ("f", autre.dernier());
+}
+
+TEST_F(FileTest, copieDUneFilePleine) {
+	File<int> f(3);
+	for (int i = 0; i < 3; ++i)
+		f.enfiler(i);
+	f.defiler();
+	f.enfiler(3);
+	File<int> copie(f);
+	EXPECT_TRUE(copie.estPleine());
+	EXPECT_EQ(1, copie.defiler());
+	copie.enfiler(4);
+	EXPECT_EQ(2, copie[0]);
+	EXPECT_EQ(4, copie.dernier());
+}
+
+TEST_F(FileTest, deplacementRepriseDuTableau) {
+	File<std::string> f(4);
+	f.enfiler("a");
+	f.enfiler("b");
+	const std::string * premier = &f.premier();
+
+	File<std::string> deplacee(std::move(f));
+	EXPECT_EQ(premier, &deplacee.premier());
+	EXPECT_EQ(2, deplacee.taille());
+	EXPECT_EQ(0, f.taille());
+
+	File<std::string> autre(1);
+	autre.enfiler("x");
+	autre = std::move(deplacee);
+	EXPECT_EQ(premier, &autre.premier());
+	EXPECT_EQ("b", autre.dernier());
+
+	f = autre;
+	EXPECT_EQ(2, f.taille());
+	EXPECT_EQ("a", f.defiler());
+}
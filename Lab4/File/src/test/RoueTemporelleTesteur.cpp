@@ -0,0 +1,135 @@
+/**
+ * \file RoueTemporelleTesteur.cpp
+ * \brief Tests de la classe RoueTemporelle en format Google Test
+ * \version 0.1
+ *
+ * Roue temporelle hiérarchique de quatre niveaux de 64 cases
+ */
+
+#include "gtest/gtest.h"
+#include "../main/RoueTemporelle.h"
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace lab04;
+
+typedef RoueTemporelle<int> Roue;
+
+TEST(RoueTemporelleTest, RoueVideOK) {
+	Roue roue(100);
+	EXPECT_TRUE(roue.estVide());
+	EXPECT_EQ(100u, roue.maintenant());
+	std::vector<int> echues;
+	EXPECT_EQ(0, roue.avancer(1000000, std::back_inserter(echues)));
+	EXPECT_EQ(1000100u, roue.maintenant());
+	EXPECT_THROW(roue.planifier(1, 0), PreconditionException);
+}
+
+TEST(RoueTemporelleTest, echeanceAuBonTop) {
+	Roue roue;
+	roue.planifier(1, 1);
+	roue.planifier(5, 5);
+	roue.planifier(64, 64);
+	roue.planifier(100, 100);
+	roue.planifier(5000, 5000);
+	EXPECT_EQ(5, roue.taille());
+
+	std::vector<int> echues;
+	EXPECT_EQ(0, roue.avancer(0, std::back_inserter(echues)));
+	for (Roue::Temps t = 1; t <= 5000; ++t) {
+		echues.clear();
+		roue.avancer(1, std::back_inserter(echues));
+		if (t == 1 || t == 5 || t == 64 || t == 100 || t == 5000) {
+			ASSERT_EQ(1u, echues.size());
+			EXPECT_EQ(static_cast<int>(t), echues[0]);
+		} else {
+			ASSERT_TRUE(echues.empty());
+		}
+	}
+	EXPECT_TRUE(roue.estVide());
+}
+
+TEST(RoueTemporelleTest, sautDeTopsSansTravail) {
+	Roue roue(7);
+	roue.planifier(1, 300000);
+	roue.planifier(2, 300001);
+	std::vector<int> echues;
+	EXPECT_EQ(0, roue.avancer(299999, std::back_inserter(echues)));
+	EXPECT_EQ(1, roue.avancer(1, std::back_inserter(echues)));
+	EXPECT_EQ(1, echues[0]);
+	EXPECT_EQ(1, roue.avancer(10, std::back_inserter(echues)));
+	EXPECT_EQ(2, echues[1]);
+	EXPECT_EQ(7u + 300010u, roue.maintenant());
+}
+
+TEST(RoueTemporelleTest, lotsEnOrdreDEcheance) {
+	Roue roue(12345);
+	std::vector<int> attendues;
+	for (int i = 1; i <= 2000; ++i) {
+		const int delai = (i * 7919) % 20000 + 1;
+		roue.planifier(delai, delai);
+		attendues.push_back(delai);
+	}
+	std::sort(attendues.begin(), attendues.end());
+
+	std::vector<int> echues;
+	int total = 0;
+	while (!roue.estVide())
+		total += roue.avancer(777, std::back_inserter(echues));
+	EXPECT_EQ(2000, total);
+	EXPECT_EQ(attendues, echues);
+}
+
+TEST(RoueTemporelleTest, annulerEnO1) {
+	Roue roue;
+	Roue::Poignee p1 = roue.planifier(1, 10);
+	Roue::Poignee p2 = roue.planifier(2, 10);
+	Roue::Poignee p3 = roue.planifier(3, 10000);
+	EXPECT_TRUE(roue.annuler(p2));
+	EXPECT_FALSE(roue.annuler(p2));
+	EXPECT_TRUE(roue.annuler(p3));
+	EXPECT_EQ(1, roue.taille());
+
+	std::vector<int> echues;
+	roue.avancer(20000, std::back_inserter(echues));
+	ASSERT_EQ(1u, echues.size());
+	EXPECT_EQ(1, echues[0]);
+	EXPECT_FALSE(roue.estActive(p1));
+	EXPECT_FALSE(roue.annuler(p1));
+}
+
+TEST(RoueTemporelleTest, poigneePerimeeApresReutilisation) {
+	Roue roue;
+	Roue::Poignee ancienne = roue.planifier(1, 5);
+	roue.annuler(ancienne);
+	Roue::Poignee nouvelle = roue.planifier(2, 5);
+	EXPECT_NE(ancienne, nouvelle);
+	EXPECT_FALSE(roue.annuler(ancienne));
+	EXPECT_TRUE(roue.estActive(nouvelle));
+	EXPECT_FALSE(roue.estActive(12345678));
+}
+
+TEST(RoueTemporelleTest, delaiAuDelaDeLHorizon) {
+	Roue roue(3);
+	const Roue::Temps horizon = Roue::Temps(1) << 24;
+	roue.planifier(1, 3 * horizon + 17);
+	roue.planifier(2, horizon - 1);
+	std::vector<int> echues;
+	EXPECT_EQ(1, roue.avancer(horizon - 1, std::back_inserter(echues)));
+	EXPECT_EQ(0, roue.avancer(2 * horizon + 17, std::back_inserter(echues)));
+	EXPECT_EQ(1, roue.avancer(1, std::back_inserter(echues)));
+	EXPECT_EQ(1, echues[1]);
+}
+
+TEST(RoueTemporelleTest, elementsNonTriviaux) {
+	RoueTemporelle<std::string> roue;
+	roue.planifier("deux", 2);
+	roue.planifier("un", 1);
+	std::vector<std::string> echues;
+	roue.avancer(2, std::back_inserter(echues));
+	ASSERT_EQ(2u, echues.size());
+	EXPECT_EQ("un", echues[0]);
+	EXPECT_EQ("deux", echues[1]);
+}
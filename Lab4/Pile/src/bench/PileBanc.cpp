@@ -0,0 +1,300 @@
+/**
+ * \file PileBanc.cpp
+ * \brief Bancs d'essai de Pile comparée aux conteneurs de la STL.
+ * \version 0.1
+ *
+ * Mesure empiler, depiler, la copie et le parcours par profondeur pour
+ * Pile, PilePersistante, PileSegmentee, PileTableau, std::stack (sur std::deque et sur std::vector) et std::vector.
+ * Les défauts de cache sont publiés lorsque les compteurs perf sont accessibles.
+ *
+ * BM_oscillation simule la pile d'un parcours en profondeur itératif dont la
+ * profondeur monte et descend sans cesse.
+ *
+ * BM_proprietaire mesure le côté propriétaire de PileVolable (sans
+ * compare-and-swap) face aux piles partagées, sans contention.
+ *
+ * BM_partagee mesure une pile partagée entre plusieurs fils qui empilent et
+ * dépilent en alternance: PileConcurrente face à Pile protégée par un mutex.
+ */
+
+#include <mutex>
+#include <stack>
+#include <vector>
+#include "CompteurCache.h"
+#include "../main/Pile.h"
+#include "../main/PileConcurrente.h"
+#include "../main/PilePersistante.h"
+#include "../main/PileSegmentee.h"
+#include "../main/PileTableau.h"
+#include "../main/PileVolable.h"
+
+using namespace lab04;
+
+namespace
+{
+/**
+ * \class Operations
+ *
+ * \brief Adapte l'interface de chaque conteneur aux opérations mesurées.
+ */
+template<typename C>
+struct Operations;
+
+template<>
+struct Operations<Pile<int> >
+{
+	static void empiler(Pile<int> & p_c, int p_el) { p_c.empiler(p_el); }
+	static int depiler(Pile<int> & p_c) { return p_c.depiler(); }
+	static int acces(const Pile<int> & p_c, int p_profondeur) { return p_c[p_profondeur]; }
+};
+
+template<>
+struct Operations<PilePersistante<int> >
+{
+	static void empiler(PilePersistante<int> & p_c, int p_el) { p_c.empiler(p_el); }
+	static int depiler(PilePersistante<int> & p_c) { return p_c.depiler(); }
+	static int acces(const PilePersistante<int> & p_c, int p_profondeur) { return p_c[p_profondeur]; }
+};
+
+template<>
+struct Operations<PileSegmentee<int> >
+{
+	static void empiler(PileSegmentee<int> & p_c, int p_el) { p_c.empiler(p_el); }
+	static int depiler(PileSegmentee<int> & p_c) { return p_c.depiler(); }
+	static int acces(const PileSegmentee<int> & p_c, int p_profondeur) { return p_c[p_profondeur]; }
+};
+
+template<>
+struct Operations<PileTableau<int> >
+{
+	static void empiler(PileTableau<int> & p_c, int p_el) { p_c.empiler(p_el); }
+	static int depiler(PileTableau<int> & p_c) { return p_c.depiler(); }
+	static int acces(const PileTableau<int> & p_c, int p_profondeur) { return p_c[p_profondeur]; }
+};
+
+template<typename S>
+struct Operations<std::stack<int, S> >
+{
+	static void empiler(std::stack<int, S> & p_c, int p_el) { p_c.push(p_el); }
+	static int depiler(std::stack<int, S> & p_c) { int el = p_c.top(); p_c.pop(); return el; }
+};
+
+template<>
+struct Operations<std::vector<int> >
+{
+	static void empiler(std::vector<int> & p_c, int p_el) { p_c.push_back(p_el); }
+	static int depiler(std::vector<int> & p_c) { int el = p_c.back(); p_c.pop_back(); return el; }
+	static int acces(const std::vector<int> & p_c, int p_profondeur)
+	{
+		return p_c[p_c.size() - 1 - p_profondeur];
+	}
+};
+
+template<typename C>
+void remplir(C & p_c, int p_n)
+{
+	for (int i = 0; i < p_n; ++i)
+		Operations<C>::empiler(p_c, i);
+}
+
+template<typename C>
+void BM_empiler(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C c;
+		remplir(c, n);
+		benchmark::DoNotOptimize(&c);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_empilerDepiler(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C c;
+		remplir(c, n);
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += Operations<C>::depiler(c);
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+template<typename C>
+void BM_copie(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C copie(source);
+		benchmark::DoNotOptimize(&copie);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_parcours(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C source;
+	remplir(source, n);
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		int somme = 0;
+		for (int i = 0; i < n; ++i)
+			somme += Operations<C>::acces(source, i);
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n);
+}
+
+template<typename C>
+void BM_oscillation(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	MesureCache mesure(p_etat);
+	for (auto _ : p_etat)
+	{
+		C c;
+		int somme = 0;
+		for (int vague = 1; vague <= 8; ++vague)
+		{
+			for (int i = 0; i < n; ++i)
+				Operations<C>::empiler(c, i);
+			for (int i = 0; i < n - n / vague; ++i)
+				somme += Operations<C>::depiler(c);
+		}
+		benchmark::DoNotOptimize(somme);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 8);
+}
+
+/**
+ * \class PileMutex
+ *
+ * \brief Pile protégée par un seul mutex, la référence de BM_partagee.
+ */
+class PileMutex
+{
+public:
+	void empiler(int p_el)
+	{
+		std::lock_guard<std::mutex> garde(m_verrou);
+		m_pile.empiler(p_el);
+	}
+
+	bool depiler(int & p_el)
+	{
+		std::lock_guard<std::mutex> garde(m_verrou);
+		if (m_pile.estVide())
+			return false;
+		p_el = m_pile.depiler();
+		return true;
+	}
+
+private:
+	std::mutex m_verrou;
+	Pile<int> m_pile;
+};
+
+template<typename C>
+void BM_partagee(benchmark::State & p_etat)
+{
+	static C * partagee = 0;
+	if (p_etat.thread_index() == 0)
+		partagee = new C();
+	int el = 0;
+	for (auto _ : p_etat)
+	{
+		partagee->empiler(p_etat.thread_index());
+		partagee->depiler(el);
+	}
+	benchmark::DoNotOptimize(el);
+	p_etat.SetItemsProcessed(p_etat.iterations() * 2);
+	if (p_etat.thread_index() == 0)
+	{
+		delete partagee;
+		partagee = 0;
+	}
+}
+
+template<typename C>
+void BM_proprietaire(benchmark::State & p_etat)
+{
+	const int n = static_cast<int>(p_etat.range(0));
+	C c;
+	int el = 0;
+	for (auto _ : p_etat)
+	{
+		for (int i = 0; i < n; ++i)
+			c.empiler(i);
+		for (int i = 0; i < n; ++i)
+			c.depiler(el);
+		benchmark::DoNotOptimize(el);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * n * 2);
+}
+
+typedef std::stack<int> PileDeque;
+typedef std::stack<int, std::vector<int> > PileVecteur;
+
+} // namespace
+
+#define BANC_PILE(banc, conteneur) \
+	BENCHMARK_TEMPLATE(banc, conteneur)->RangeMultiplier(8)->Range(8, 1 << 15)
+
+BANC_PILE(BM_empiler, Pile<int>);
+BANC_PILE(BM_empiler, PilePersistante<int>);
+BANC_PILE(BM_empiler, PileSegmentee<int>);
+BANC_PILE(BM_empiler, PileTableau<int>);
+BANC_PILE(BM_empiler, PileDeque);
+BANC_PILE(BM_empiler, PileVecteur);
+BANC_PILE(BM_empiler, std::vector<int>);
+
+BANC_PILE(BM_empilerDepiler, Pile<int>);
+BANC_PILE(BM_empilerDepiler, PilePersistante<int>);
+BANC_PILE(BM_empilerDepiler, PileSegmentee<int>);
+BANC_PILE(BM_empilerDepiler, PileTableau<int>);
+BANC_PILE(BM_empilerDepiler, PileDeque);
+BANC_PILE(BM_empilerDepiler, PileVecteur);
+BANC_PILE(BM_empilerDepiler, std::vector<int>);
+
+BANC_PILE(BM_copie, Pile<int>);
+BANC_PILE(BM_copie, PilePersistante<int>);
+BANC_PILE(BM_copie, PileSegmentee<int>);
+BANC_PILE(BM_copie, PileTableau<int>);
+BANC_PILE(BM_copie, PileDeque);
+BANC_PILE(BM_copie, PileVecteur);
+BANC_PILE(BM_copie, std::vector<int>);
+
+// operator[] de Pile parcourt la chaîne: le parcours complet est quadratique.
+BENCHMARK_TEMPLATE(BM_parcours, Pile<int>)->RangeMultiplier(8)->Range(8, 1 << 12);
+BANC_PILE(BM_parcours, PileSegmentee<int>);
+BANC_PILE(BM_parcours, PileTableau<int>);
+BANC_PILE(BM_parcours, std::vector<int>);
+
+BANC_PILE(BM_oscillation, Pile<int>);
+BANC_PILE(BM_oscillation, PileSegmentee<int>);
+BANC_PILE(BM_oscillation, PileTableau<int>);
+BANC_PILE(BM_oscillation, std::vector<int>);
+
+BANC_PILE(BM_proprietaire, PileVolable<int>);
+BANC_PILE(BM_proprietaire, PileConcurrente<int>);
+BANC_PILE(BM_proprietaire, PileMutex);
+
+BENCHMARK_TEMPLATE(BM_partagee, PileConcurrente<int>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_partagee, PileMutex)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
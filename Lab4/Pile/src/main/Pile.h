@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 namespace lab04
 {
@@ -35,7 +36,10 @@ public:
 	~Pile();
 
 	void empiler(const T &);
+	void empiler(T &&);
+	template<typename... Args> void emplace(Args &&...);
 	T depiler();
+	void depiler(T &);
 
 	bool estVide() const;
 	int taille() const;
@@ -70,6 +74,17 @@ private:
 			m_el(data_item), m_suivant(next_ptr)
 		{
 		}
+
+		/**
+		 * \brief Constructeur d'un noeud dont l'élément est construit sur place.
+		 *
+		 * \post L'élément est construit à partir de args.
+		 */
+		template<typename... Args>
+		explicit Noeud(Noeud * next_ptr, Args &&... args) :
+			m_el(std::forward<Args>(args)...), m_suivant(next_ptr)
+		{
+		}
 	};
 
 	/**
@@ -84,12 +99,8 @@ private:
 	int m_cardinalite; /*!<Cardinalité de la pile*/
 
 	// Méthodes privées
-
-    // À titre indicatif, voici les méthodes privées de la solution
-    /*
 	void _detruire();
 	void _copier(const Pile<T> &);
-    */
 
 };
 } //Fin du namespace
@@ -4,8 +4,6 @@
 
 namespace lab04 {
 
-// À compléter ...
-
 template<typename T>
 std::ostream & operator <<(std::ostream & p_out, const Pile<T> & p_source) 
 {
@@ -22,91 +20,237 @@ std::ostream & operator <<(std::ostream & p_out, const Pile<T> & p_source)
 	return p_out;
 }
 
-    template<typename T>
-    int Pile<T>::taille() const
-    {
-        return 0;
-    }
-
-    template<typename T>
-    Pile<T>::Pile()
-    {
-
-    }
-
-    template<typename T>
-    Pile<T>::Pile(const Pile &)
-    {
-
-    }
-
-    template<typename T>
-    Pile<T>::~Pile()
-    {
-        destruct(m_sommet)
-    }
-
-    if (sommet != m_sommet && sommet->suivant != nullptr)
-        destruct(sommet -> suivant)
-    ladestruction
-
-    template<typename T>
-    void Pile<T>::empiler(const T &)
-    {
-
-    }
-
-    template<typename T>
-    T Pile<T>::depiler()
-    {
-        /**
-         * 1. retrouver l element du sommet
-         * 2. creer une sentinelle sur le sommet
-         * 3. sommet = sommet->m_suivant
-         * 4. ladestruction(sentinelle)
-         */
-        return nullptr;
-    }
-
-    template<typename T>
-    bool Pile<T>::estVide() const
-    {
-        return false;
-    }
-
-    template<typename T>
-    const T &Pile<T>::top() const
-    {
-        return this->m_sommet->m_el;
-    }
-
-    template<typename T>
-    T Pile<T>::operator[](const int & index) const
-    {
-        PRECONDITION(index >= 0);
-        PRECONDITION(index < this->m_cardinalite);
-
-        elem sentinelle = this->m_sommet;
-        for (int i = 0; i < index; i++)
-        {
-            sentinelle = sentinelle->m_suivant;
-        }
-        return sentinelle->m_el;
-    }
-
-    template<typename T>
-    const Pile <T> &Pile<T>::operator=(const Pile <T> &)
-    {
-        return Pile();
-    }
-
-    template<typename T>
-    void Pile<T>::verifieInvariant() const
-    {
-
-    }
+/**
+ * \brief Constructeur d'une pile vide
+ * \post La pile est vide
+ */
+template<typename T>
+Pile<T>::Pile() :
+	m_sommet(nullptr), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La pile à copier
+ * \post La pile est une copie profonde de p_source
+ */
+template<typename T>
+Pile<T>::Pile(const Pile & p_source) :
+	m_sommet(nullptr), m_cardinalite(0)
+{
+	_copier(p_source);
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+Pile<T>::~Pile()
+{
+	_detruire();
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile
+ * \param[in] p_el L'élément à empiler
+ * \post L'élément est au sommet
+ */
+template<typename T>
+void Pile<T>::empiler(const T & p_el)
+{
+	m_sommet = new Noeud(p_el, m_sommet);
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile en le déplaçant
+ * \param[in] p_el L'élément à empiler, dont le contenu est déplacé dans le noeud
+ * \post L'élément est au sommet
+ */
+template<typename T>
+void Pile<T>::empiler(T && p_el)
+{
+	m_sommet = new Noeud(m_sommet, std::move(p_el));
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Construit un élément directement au sommet de la pile
+ * \param[in] p_args Les arguments passés au constructeur de T
+ * \post Le nouvel élément est au sommet
+ */
+template<typename T>
+template<typename... Args>
+void Pile<T>::emplace(Args &&... p_args)
+{
+	m_sommet = new Noeud(m_sommet, std::forward<Args>(p_args)...);
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile
+ *
+ * L'élément est déplacé hors du noeud avant que celui-ci soit libéré.
+ *
+ * \return L'élément retiré
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+T Pile<T>::depiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	elem sentinelle = m_sommet;
+	T el(std::move(sentinelle->m_el));
+	m_sommet = sentinelle->m_suivant;
+	delete sentinelle;
+	--m_cardinalite;
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile en le déplaçant dans un objet existant
+ *
+ * Les ressources de p_el (par exemple la capacité d'un vecteur) sont
+ * remplacées par celles de l'élément, sans construire de temporaire.
+ *
+ * \param[out] p_el Reçoit l'élément retiré, par assignation de déplacement
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+void Pile<T>::depiler(T & p_el)
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	elem sentinelle = m_sommet;
+	p_el = std::move(sentinelle->m_el);
+	m_sommet = sentinelle->m_suivant;
+	delete sentinelle;
+	--m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ */
+template<typename T>
+bool Pile<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int Pile<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Retourne l'élément au sommet sans le retirer
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+const T & Pile<T>::top() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_el;
+}
+
+/**
+ * \brief Retourne l'élément à une profondeur donnée, 0 étant le sommet
+ * \param[in] p_index La profondeur
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+T Pile<T>::operator[](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	elem sentinelle = m_sommet;
+	for (int i = 0; i < p_index; i++)
+	{
+		sentinelle = sentinelle->m_suivant;
+	}
+	return sentinelle->m_el;
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La pile à copier
+ * \return La pile courante, devenue une copie profonde de p_source
+ */
+template<typename T>
+const Pile<T> & Pile<T>::operator =(const Pile<T> & p_source)
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		_copier(p_source);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et le sommet
+ */
+template<typename T>
+void Pile<T>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT((m_cardinalite == 0) == (m_sommet == nullptr));
+}
 
 // Méthodes privées
 
+/**
+ * \brief Libère tous les noeuds
+ * \post La pile est vide
+ */
+template<typename T>
+void Pile<T>::_detruire()
+{
+	while (m_sommet != nullptr)
+	{
+		elem suivant = m_sommet->m_suivant;
+		delete m_sommet;
+		m_sommet = suivant;
+	}
+	m_cardinalite = 0;
+}
+
+/**
+ * \brief Copie les noeuds d'une autre pile en gardant leur ordre
+ * \param[in] p_source La pile à copier
+ * \pre La pile courante est vide
+ */
+template<typename T>
+void Pile<T>::_copier(const Pile<T> & p_source)
+{
+	elem * queue = &m_sommet;
+	for (elem courant = p_source.m_sommet; courant != nullptr; courant = courant->m_suivant)
+	{
+		*queue = new Noeud(courant->m_el);
+		queue = &(*queue)->m_suivant;
+		++m_cardinalite;
+	}
+}
 
 } //Fin du namespace
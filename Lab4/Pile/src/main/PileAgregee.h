@@ -0,0 +1,95 @@
+/**
+ * \file PileAgregee.h
+ * \brief Classe définissant le type abstrait pile, avec agrégats maintenus
+ * \version 0.1
+ *
+ * Représentation dans une liste chaînée où chaque noeud garde le minimum,
+ * le maximum et le repli des éléments situés à sa profondeur et en dessous
+ */
+
+#ifndef PILEAGREGEE_H
+#define PILEAGREGEE_H
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+namespace lab04
+{
+/**
+ * \class PileAgregee
+ *
+ * \brief Classe générique représentant une Pile dont les agrégats sont en O(1).
+ *
+ *  Même interface que Pile, plus min(), max() et agregat(). Chaque noeud
+ *  mémorise les agrégats de la pile telle qu'elle était lorsqu'il est
+ *  devenu le sommet: depiler n'a donc rien à recalculer.
+ *
+ *  Operation est un foncteur associatif; agregat() vaut
+ *  op(...op(op(fond, e2), e3)..., sommet). min() et max() utilisent
+ *  l'opérateur < de T.
+ */
+template<typename T, typename Operation = std::plus<T> >
+class PileAgregee
+{
+public:
+	explicit PileAgregee(const Operation & = Operation());
+	PileAgregee(const PileAgregee &);
+	~PileAgregee();
+
+	void empiler(const T &);
+	T depiler();
+
+	bool estVide() const;
+	int taille() const;
+	const T& top() const;
+
+	const T& min() const;
+	const T& max() const;
+	const T& agregat() const;
+
+	T operator[](const int &) const;
+	const PileAgregee<T, Operation> & operator =(const PileAgregee<T, Operation> &);
+
+	void verifieInvariant() const;
+
+	template<typename U, typename O> friend std::ostream& operator <<(std::ostream &,
+			const PileAgregee<U, O> &);
+
+private:
+	/**
+	 * \class Noeud
+	 *
+	 * \brief Classe interne représentant un noeud (une position) dans la pile.
+	 */
+	class Noeud
+	{
+	public:
+		T m_el; /*!<L'élément de base de la pile*/
+		T m_min; /*!<Le minimum des éléments de ce noeud jusqu'au fond*/
+		T m_max; /*!<Le maximum des éléments de ce noeud jusqu'au fond*/
+		T m_agregat; /*!<Le repli des éléments du fond jusqu'à ce noeud*/
+		Noeud * m_suivant; /*!<Un pointeur vers le noeud suivant*/
+
+		Noeud(const T& data_item, const T& min, const T& max, const T& agregat,
+				Noeud * next_ptr = nullptr) :
+			m_el(data_item), m_min(min), m_max(max), m_agregat(agregat), m_suivant(next_ptr)
+		{
+		}
+	};
+
+	using elem = Noeud *;
+
+	elem m_sommet; /*!<Pointeur vers le premier noeud, le sommet de la pile*/
+	int m_cardinalite; /*!<Cardinalité de la pile*/
+	Operation m_operation; /*!<Le foncteur de repli*/
+
+	// Méthodes privées
+	void _detruire();
+	void _copier(const PileAgregee<T, Operation> &);
+};
+} //Fin du namespace
+
+#include "PileAgregee.hpp"
+
+#endif
@@ -0,0 +1,257 @@
+#include "ContratException.h"
+
+namespace lab04
+{
+
+/**
+ * \brief Affiche la pile, du sommet vers le fond
+ */
+template<typename T, typename Operation>
+std::ostream & operator <<(std::ostream & p_out, const PileAgregee<T, Operation> & p_source)
+{
+	p_out << "Pile: [";
+	for (typename PileAgregee<T, Operation>::elem courant = p_source.m_sommet;
+			courant != nullptr; courant = courant->m_suivant)
+	{
+		p_out << courant->m_el;
+		if (courant->m_suivant != nullptr)
+			p_out << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \param[in] p_operation Le foncteur associatif de repli
+ * \post La pile est vide
+ */
+template<typename T, typename Operation>
+PileAgregee<T, Operation>::PileAgregee(const Operation & p_operation) :
+	m_sommet(nullptr), m_cardinalite(0), m_operation(p_operation)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La pile à copier
+ * \post La pile est une copie profonde de p_source, agrégats compris
+ */
+template<typename T, typename Operation>
+PileAgregee<T, Operation>::PileAgregee(const PileAgregee & p_source) :
+	m_sommet(nullptr), m_cardinalite(0), m_operation(p_source.m_operation)
+{
+	_copier(p_source);
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T, typename Operation>
+PileAgregee<T, Operation>::~PileAgregee()
+{
+	_detruire();
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile
+ *
+ * Les agrégats du nouveau sommet sont dérivés de ceux de l'ancien.
+ *
+ * \param[in] p_el L'élément à empiler
+ * \post L'élément est au sommet
+ */
+template<typename T, typename Operation>
+void PileAgregee<T, Operation>::empiler(const T & p_el)
+{
+	if (m_sommet == nullptr)
+	{
+		m_sommet = new Noeud(p_el, p_el, p_el, p_el);
+	}
+	else
+	{
+		m_sommet = new Noeud(p_el,
+				p_el < m_sommet->m_min ? p_el : m_sommet->m_min,
+				m_sommet->m_max < p_el ? p_el : m_sommet->m_max,
+				m_operation(m_sommet->m_agregat, p_el),
+				m_sommet);
+	}
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile
+ * \return L'élément retiré
+ * \pre La pile n'est pas vide
+ */
+template<typename T, typename Operation>
+T PileAgregee<T, Operation>::depiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	elem sentinelle = m_sommet;
+	T el = sentinelle->m_el;
+	m_sommet = sentinelle->m_suivant;
+	delete sentinelle;
+	--m_cardinalite;
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ */
+template<typename T, typename Operation>
+bool PileAgregee<T, Operation>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T, typename Operation>
+int PileAgregee<T, Operation>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Retourne l'élément au sommet sans le retirer
+ * \pre La pile n'est pas vide
+ */
+template<typename T, typename Operation>
+const T & PileAgregee<T, Operation>::top() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_el;
+}
+
+/**
+ * \brief Retourne le plus petit élément de la pile, en O(1)
+ * \pre La pile n'est pas vide
+ */
+template<typename T, typename Operation>
+const T & PileAgregee<T, Operation>::min() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_min;
+}
+
+/**
+ * \brief Retourne le plus grand élément de la pile, en O(1)
+ * \pre La pile n'est pas vide
+ */
+template<typename T, typename Operation>
+const T & PileAgregee<T, Operation>::max() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_max;
+}
+
+/**
+ * \brief Retourne le repli de tous les éléments, du fond au sommet, en O(1)
+ * \pre La pile n'est pas vide
+ */
+template<typename T, typename Operation>
+const T & PileAgregee<T, Operation>::agregat() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_agregat;
+}
+
+/**
+ * \brief Retourne l'élément à une profondeur donnée, 0 étant le sommet
+ * \param[in] p_index La profondeur
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T, typename Operation>
+T PileAgregee<T, Operation>::operator[](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	elem sentinelle = m_sommet;
+	for (int i = 0; i < p_index; i++)
+	{
+		sentinelle = sentinelle->m_suivant;
+	}
+	return sentinelle->m_el;
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La pile à copier
+ * \return La pile courante, devenue une copie profonde de p_source
+ */
+template<typename T, typename Operation>
+const PileAgregee<T, Operation> & PileAgregee<T, Operation>::operator =(
+		const PileAgregee<T, Operation> & p_source)
+{
+	if (this != &p_source)
+	{
+		_detruire();
+		m_operation = p_source.m_operation;
+		_copier(p_source);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et le sommet
+ */
+template<typename T, typename Operation>
+void PileAgregee<T, Operation>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT((m_cardinalite == 0) == (m_sommet == nullptr));
+	INVARIANT(m_sommet == nullptr || !(m_sommet->m_el < m_sommet->m_min));
+	INVARIANT(m_sommet == nullptr || !(m_sommet->m_max < m_sommet->m_el));
+}
+
+// Méthodes privées
+
+/**
+ * \brief Libère tous les noeuds
+ * \post La pile est vide
+ */
+template<typename T, typename Operation>
+void PileAgregee<T, Operation>::_detruire()
+{
+	while (m_sommet != nullptr)
+	{
+		elem suivant = m_sommet->m_suivant;
+		delete m_sommet;
+		m_sommet = suivant;
+	}
+	m_cardinalite = 0;
+}
+
+/**
+ * \brief Copie les noeuds d'une autre pile en gardant leur ordre et leurs agrégats
+ * \param[in] p_source La pile à copier
+ * \pre La pile courante est vide
+ */
+template<typename T, typename Operation>
+void PileAgregee<T, Operation>::_copier(const PileAgregee<T, Operation> & p_source)
+{
+	elem * queue = &m_sommet;
+	for (elem courant = p_source.m_sommet; courant != nullptr; courant = courant->m_suivant)
+	{
+		*queue = new Noeud(courant->m_el, courant->m_min, courant->m_max, courant->m_agregat);
+		queue = &(*queue)->m_suivant;
+		++m_cardinalite;
+	}
+}
+
+} //Fin du namespace
@@ -0,0 +1,107 @@
+/**
+ * \file PileConcurrente.h
+ * \brief Classe définissant une pile partagée entre plusieurs fils.
+ * \version 0.1
+ *
+ * Pile de Treiber sans verrou: le sommet est remplacé par compare-and-swap.
+ * Chaque pointeur partagé est accompagné d'une étiquette de 16 bits,
+ * incrémentée à chaque modification, ce qui empêche le problème ABA. Les
+ * noeuds dépilés ne sont jamais rendus au système pendant la vie de la pile:
+ * ils sont recyclés par une seconde pile de Treiber de noeuds libres, de
+ * sorte qu'un fil retardé ne lit jamais de mémoire libérée.
+ *
+ * Lorsque le compare-and-swap échoue, le fil passe par un tableau
+ * d'élimination: un empiler y dépose son noeud et un depiler concurrent
+ * peut le prendre directement, sans toucher au sommet partagé.
+ */
+
+#ifndef PILECONCURRENTE_H
+#define PILECONCURRENTE_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lab04
+{
+/**
+ * \class PileConcurrente
+ *
+ * \brief Classe générique représentant une Pile partagée entre plusieurs fils.
+ *
+ *  empiler, depiler et estVide peuvent être appelés en même temps par
+ *  plusieurs fils. depiler indique par sa valeur de retour si un élément
+ *  a été obtenu, puisqu'un test estVide préalable peut déjà être périmé.
+ */
+template<typename T>
+class PileConcurrente
+{
+public:
+	PileConcurrente();
+	~PileConcurrente();
+
+	void empiler(const T &);
+	bool depiler(T &);
+
+	bool estVide() const;
+
+private:
+	PileConcurrente(const PileConcurrente &);
+	const PileConcurrente<T> & operator =(const PileConcurrente<T> &);
+
+	/**
+	 * \class Noeud
+	 *
+	 * \brief Classe interne représentant un noeud (une position) dans la pile.
+	 *
+	 * L'élément n'est construit que pendant que le noeud est dans la pile
+	 * ou dans le tableau d'élimination. Le lien est atomique parce qu'un
+	 * fil retardé peut le lire pendant que le noeud est recyclé.
+	 */
+	class Noeud
+	{
+	public:
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type m_el; /*!<L'élément de base de la pile*/
+		std::atomic<Noeud *> m_suivant; /*!<Un pointeur vers le noeud suivant*/
+		Noeud * m_alloue; /*!<Chaîne de tous les noeuds alloués, pour le destructeur*/
+
+		Noeud() :
+			m_suivant(0), m_alloue(0)
+		{
+		}
+
+		T * element()
+		{
+			return reinterpret_cast<T *>(&m_el);
+		}
+	};
+
+	typedef Noeud * elem;
+	typedef std::uint64_t etiquete; /*!<Pointeur dans les 48 bits bas, étiquette dans les 16 bits hauts*/
+
+	static const int NB_CASES_ELIMINATION = 8; /*!<Taille du tableau d'élimination*/
+	static const int ATTENTE_ELIMINATION = 128; /*!<Nombre de tours qu'un empiler attend dans le tableau*/
+
+	std::atomic<etiquete> m_sommet; /*!<Sommet de la pile*/
+	std::atomic<etiquete> m_libres; /*!<Sommet de la pile des noeuds recyclés*/
+	std::atomic<elem> m_alloues; /*!<Tous les noeuds alloués, chaînés par m_alloue*/
+	std::atomic<etiquete> m_elimination[NB_CASES_ELIMINATION]; /*!<Noeuds offerts par empiler*/
+
+	// Méthodes privées
+	elem _obtenirNoeud();
+	void _recycler(elem);
+	static bool _essayerEmpiler(std::atomic<etiquete> &, elem);
+	static bool _essayerDepiler(std::atomic<etiquete> &, elem &);
+	bool _offrir(elem);
+	elem _prendre();
+	static int _case();
+	static etiquete _remplacer(etiquete, elem);
+	static elem _pointeur(etiquete);
+};
+} //Fin du namespace
+
+#include "PileConcurrente.hpp"
+
+#endif
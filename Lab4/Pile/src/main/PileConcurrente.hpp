@@ -0,0 +1,279 @@
+#include "ContratException.h"
+
+namespace lab04
+{
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \post La pile est vide
+ */
+template<typename T>
+PileConcurrente<T>::PileConcurrente() :
+	m_sommet(0), m_libres(0), m_alloues(0)
+{
+	static_assert(sizeof(void *) == sizeof(etiquete),
+			"PileConcurrente range l'étiquette dans les bits hauts d'un pointeur de 64 bits");
+	for (int i = 0; i < NB_CASES_ELIMINATION; ++i)
+		m_elimination[i].store(0);
+}
+
+/**
+ * \brief Destructeur
+ *
+ * Détruit les éléments encore empilés, puis libère tous les noeuds alloués.
+ *
+ * \pre Aucun autre fil n'utilise la pile
+ */
+template<typename T>
+PileConcurrente<T>::~PileConcurrente()
+{
+	for (elem courant = _pointeur(m_sommet.load()); courant != 0;
+			courant = courant->m_suivant.load())
+	{
+		courant->element()->~T();
+	}
+	elem courant = m_alloues.load();
+	while (courant != 0)
+	{
+		elem suivant = courant->m_alloue;
+		delete courant;
+		courant = suivant;
+	}
+}
+
+/**
+ * \brief Empile un élément
+ *
+ * Tant que le compare-and-swap sur le sommet échoue, le noeud est offert
+ * dans le tableau d'élimination avant de réessayer.
+ *
+ * \param[in] p_el L'élément à empiler
+ */
+template<typename T>
+void PileConcurrente<T>::empiler(const T & p_el)
+{
+	elem nouveau = _obtenirNoeud();
+	try
+	{
+		new (&nouveau->m_el) T(p_el);
+	}
+	catch (...)
+	{
+		_recycler(nouveau);
+		throw;
+	}
+
+	while (!_essayerEmpiler(m_sommet, nouveau))
+	{
+		if (_offrir(nouveau))
+			return;
+	}
+}
+
+/**
+ * \brief Dépile un élément
+ *
+ * Tant que le compare-and-swap sur le sommet échoue, le fil tente de
+ * prendre un noeud offert par un empiler concurrent.
+ *
+ * \param[out] p_el Reçoit l'élément dépilé
+ * \return true si un élément a été dépilé, false si la pile était vide
+ */
+template<typename T>
+bool PileConcurrente<T>::depiler(T & p_el)
+{
+	elem sommet = 0;
+	while (!_essayerDepiler(m_sommet, sommet))
+	{
+		sommet = _prendre();
+		if (sommet != 0)
+			break;
+	}
+	if (sommet == 0)
+		return false;
+
+	T * element = sommet->element();
+	p_el = std::move(*element);
+	element->~T();
+	_recycler(sommet);
+	return true;
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ *
+ * Sous accès concurrent, la réponse est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+bool PileConcurrente<T>::estVide() const
+{
+	return _pointeur(m_sommet.load(std::memory_order_acquire)) == 0;
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne un noeud libre, recyclé si possible
+ */
+template<typename T>
+typename PileConcurrente<T>::elem PileConcurrente<T>::_obtenirNoeud()
+{
+	elem noeud = 0;
+	while (!_essayerDepiler(m_libres, noeud))
+	{
+	}
+	if (noeud != 0)
+		return noeud;
+
+	noeud = new Noeud();
+	elem alloues = m_alloues.load(std::memory_order_relaxed);
+	do
+	{
+		noeud->m_alloue = alloues;
+	} while (!m_alloues.compare_exchange_weak(alloues, noeud,
+			std::memory_order_release, std::memory_order_relaxed));
+	return noeud;
+}
+
+/**
+ * \brief Remet un noeud, dont l'élément est détruit, dans la pile des noeuds libres
+ */
+template<typename T>
+void PileConcurrente<T>::_recycler(elem p_noeud)
+{
+	while (!_essayerEmpiler(m_libres, p_noeud))
+	{
+	}
+}
+
+/**
+ * \brief Tente une fois de placer un noeud au sommet d'une pile de Treiber
+ *
+ * \param[in,out] p_sommet Le sommet étiqueté de la pile
+ * \param[in] p_noeud Le noeud à empiler
+ * \return true si le compare-and-swap a réussi
+ */
+template<typename T>
+bool PileConcurrente<T>::_essayerEmpiler(std::atomic<etiquete> & p_sommet, elem p_noeud)
+{
+	etiquete sommet = p_sommet.load(std::memory_order_relaxed);
+	p_noeud->m_suivant.store(_pointeur(sommet), std::memory_order_relaxed);
+	return p_sommet.compare_exchange_weak(sommet, _remplacer(sommet, p_noeud),
+			std::memory_order_release, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Tente une fois de retirer le sommet d'une pile de Treiber
+ *
+ * Le lien du sommet peut être lu alors qu'un autre fil a déjà retiré et
+ * recyclé ce noeud; l'étiquette fait alors échouer le compare-and-swap.
+ *
+ * \param[in,out] p_sommet Le sommet étiqueté de la pile
+ * \param[out] p_noeud Reçoit le noeud retiré, 0 si la pile était vide
+ * \return true si la tentative a abouti (noeud retiré ou pile vide)
+ */
+template<typename T>
+bool PileConcurrente<T>::_essayerDepiler(std::atomic<etiquete> & p_sommet, elem & p_noeud)
+{
+	etiquete sommet = p_sommet.load(std::memory_order_acquire);
+	p_noeud = _pointeur(sommet);
+	if (p_noeud == 0)
+		return true;
+
+	elem suivant = p_noeud->m_suivant.load(std::memory_order_relaxed);
+	if (p_sommet.compare_exchange_weak(sommet, _remplacer(sommet, suivant),
+			std::memory_order_acquire, std::memory_order_relaxed))
+		return true;
+	p_noeud = 0;
+	return false;
+}
+
+/**
+ * \brief Offre un noeud dans une case du tableau d'élimination
+ *
+ * Le noeud y attend un moment; s'il est encore là, il est retiré.
+ *
+ * \param[in] p_noeud Le noeud à empiler, avec son élément construit
+ * \return true si un depiler a pris le noeud
+ */
+template<typename T>
+bool PileConcurrente<T>::_offrir(elem p_noeud)
+{
+	std::atomic<etiquete> & laCase = m_elimination[_case()];
+	etiquete libre = laCase.load(std::memory_order_relaxed);
+	if (_pointeur(libre) != 0)
+		return false;
+
+	etiquete offre = _remplacer(libre, p_noeud);
+	if (!laCase.compare_exchange_strong(libre, offre,
+			std::memory_order_release, std::memory_order_relaxed))
+		return false;
+
+	for (int i = 0; i < ATTENTE_ELIMINATION; ++i)
+	{
+		if (laCase.load(std::memory_order_relaxed) != offre)
+			return true;
+	}
+	return !laCase.compare_exchange_strong(offre, _remplacer(offre, 0),
+			std::memory_order_relaxed, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Prend le noeud offert dans une case du tableau d'élimination
+ *
+ * \return Le noeud pris, 0 si la case était vide ou a été prise par un autre fil
+ */
+template<typename T>
+typename PileConcurrente<T>::elem PileConcurrente<T>::_prendre()
+{
+	std::atomic<etiquete> & laCase = m_elimination[_case()];
+	etiquete offre = laCase.load(std::memory_order_acquire);
+	if (_pointeur(offre) == 0)
+		return 0;
+
+	if (laCase.compare_exchange_strong(offre, _remplacer(offre, 0),
+			std::memory_order_acquire, std::memory_order_relaxed))
+		return _pointeur(offre);
+	return 0;
+}
+
+/**
+ * \brief Choisit une case du tableau d'élimination (xorshift propre au fil)
+ */
+template<typename T>
+int PileConcurrente<T>::_case()
+{
+	static thread_local std::uint32_t graine = 0;
+	if (graine == 0)
+		graine = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&graine) >> 4) | 1u;
+	graine ^= graine << 13;
+	graine ^= graine >> 17;
+	graine ^= graine << 5;
+	return static_cast<int>(graine % NB_CASES_ELIMINATION);
+}
+
+/**
+ * \brief Construit la valeur qui remplace un sommet étiqueté
+ *
+ * \param[in] p_ancien L'ancienne valeur étiquetée
+ * \param[in] p_noeud Le nouveau pointeur
+ * \return p_noeud accompagné de l'étiquette de p_ancien plus un
+ */
+template<typename T>
+typename PileConcurrente<T>::etiquete PileConcurrente<T>::_remplacer(etiquete p_ancien, elem p_noeud)
+{
+	etiquete pointeur = static_cast<etiquete>(reinterpret_cast<std::uintptr_t>(p_noeud));
+	ASSERTION((pointeur >> 48) == 0);
+	return (((p_ancien >> 48) + 1) << 48) | pointeur;
+}
+
+/**
+ * \brief Extrait le pointeur d'une valeur étiquetée
+ */
+template<typename T>
+typename PileConcurrente<T>::elem PileConcurrente<T>::_pointeur(etiquete p_valeur)
+{
+	return reinterpret_cast<elem>(static_cast<std::uintptr_t>(p_valeur & ((etiquete(1) << 48) - 1)));
+}
+
+} //Fin du namespace
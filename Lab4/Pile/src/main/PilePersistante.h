@@ -0,0 +1,89 @@
+/**
+ * \file PilePersistante.h
+ * \brief Classe définissant le type abstrait pile, en version persistante
+ * \version 0.1
+ *
+ * Représentation dans une liste chaînée dont les noeuds sont partagés
+ * entre les copies et comptés par référence
+ */
+
+#ifndef PILEPERSISTANTE_H
+#define PILEPERSISTANTE_H
+
+#include <iostream>
+#include <stdexcept>
+
+namespace lab04
+{
+/**
+ * \class PilePersistante
+ *
+ * \brief Classe générique représentant une Pile persistante.
+ *
+ *  Même interface que Pile, mais une copie ne fait que partager la chaîne
+ *  de la source: le constructeur de copie et l'assignation sont en O(1).
+ *  Les noeuds ne sont jamais modifiés; empiler et depiler déplacent
+ *  seulement le sommet de la version courante, de sorte que les autres
+ *  versions ne voient aucun changement. Un noeud est libéré quand plus
+ *  aucune version ne l'atteint.
+ *
+ *  Le compte de références n'est pas atomique: deux versions qui
+ *  partagent des noeuds ne doivent pas être utilisées par des fils
+ *  différents.
+ */
+template<typename T>
+class PilePersistante
+{
+public:
+	PilePersistante();
+	PilePersistante(const PilePersistante &);
+	~PilePersistante();
+
+	void empiler(const T &);
+	T depiler();
+
+	bool estVide() const;
+	int taille() const;
+	const T& top() const;
+
+	T operator[](const int &) const;
+	const PilePersistante<T> & operator =(const PilePersistante<T> &);
+
+	void verifieInvariant() const;
+
+	template<typename U> friend std::ostream& operator <<(std::ostream &,
+			const PilePersistante<U> &);
+
+private:
+	/**
+	 * \class Noeud
+	 *
+	 * \brief Classe interne représentant un noeud (une position) partagé entre les versions.
+	 */
+	class Noeud
+	{
+	public:
+		const T m_el; /*!<L'élément de base de la pile*/
+		Noeud * const m_suivant; /*!<Un pointeur vers le noeud suivant, dont ce noeud détient une référence*/
+		int m_references; /*!<Nombre de versions et de noeuds qui pointent sur ce noeud*/
+
+		Noeud(const T& data_item, Noeud * next_ptr) :
+			m_el(data_item), m_suivant(next_ptr), m_references(1)
+		{
+		}
+	};
+
+	using elem = Noeud *;
+
+	elem m_sommet; /*!<Pointeur vers le premier noeud, le sommet de la pile*/
+	int m_cardinalite; /*!<Cardinalité de la pile*/
+
+	// Méthodes privées
+	static elem _retenir(elem);
+	static void _relacher(elem);
+};
+} //Fin du namespace
+
+#include "PilePersistante.hpp"
+
+#endif
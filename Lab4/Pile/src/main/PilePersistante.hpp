@@ -0,0 +1,208 @@
+#include "ContratException.h"
+
+namespace lab04
+{
+
+/**
+ * \brief Affiche la pile, du sommet vers le fond
+ */
+template<typename T>
+std::ostream & operator <<(std::ostream & p_out, const PilePersistante<T> & p_source)
+{
+	p_out << "Pile: [";
+	for (typename PilePersistante<T>::elem courant = p_source.m_sommet; courant != nullptr;
+			courant = courant->m_suivant)
+	{
+		p_out << courant->m_el;
+		if (courant->m_suivant != nullptr)
+			p_out << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \post La pile est vide
+ */
+template<typename T>
+PilePersistante<T>::PilePersistante() :
+	m_sommet(nullptr), m_cardinalite(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie, en O(1)
+ * \param[in] p_source La pile à copier
+ * \post La pile partage les noeuds de p_source et contient les mêmes éléments
+ */
+template<typename T>
+PilePersistante<T>::PilePersistante(const PilePersistante & p_source) :
+	m_sommet(_retenir(p_source.m_sommet)), m_cardinalite(p_source.m_cardinalite)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+PilePersistante<T>::~PilePersistante()
+{
+	_relacher(m_sommet);
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile
+ *
+ * Le nouveau noeud reprend la référence que la version courante détenait
+ * sur l'ancien sommet.
+ *
+ * \param[in] p_el L'élément à empiler
+ * \post L'élément est au sommet
+ */
+template<typename T>
+void PilePersistante<T>::empiler(const T & p_el)
+{
+	m_sommet = new Noeud(p_el, m_sommet);
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile
+ *
+ * L'ancien sommet n'est libéré que si aucune autre version ne l'atteint.
+ *
+ * \return L'élément retiré
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+T PilePersistante<T>::depiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	elem ancien = m_sommet;
+	T el = ancien->m_el;
+	m_sommet = _retenir(ancien->m_suivant);
+	_relacher(ancien);
+	--m_cardinalite;
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ */
+template<typename T>
+bool PilePersistante<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int PilePersistante<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Retourne l'élément au sommet sans le retirer
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+const T & PilePersistante<T>::top() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_sommet->m_el;
+}
+
+/**
+ * \brief Retourne l'élément à une profondeur donnée, 0 étant le sommet
+ * \param[in] p_index La profondeur
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+T PilePersistante<T>::operator[](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	elem courant = m_sommet;
+	for (int i = 0; i < p_index; i++)
+	{
+		courant = courant->m_suivant;
+	}
+	return courant->m_el;
+}
+
+/**
+ * \brief Opérateur d'assignation, en O(1) en plus de la libération de l'ancienne version
+ * \param[in] p_source La pile à copier
+ * \return La pile courante, qui partage maintenant les noeuds de p_source
+ */
+template<typename T>
+const PilePersistante<T> & PilePersistante<T>::operator =(const PilePersistante<T> & p_source)
+{
+	elem nouveau = _retenir(p_source.m_sommet);
+	_relacher(m_sommet);
+	m_sommet = nouveau;
+	m_cardinalite = p_source.m_cardinalite;
+
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et le sommet
+ */
+template<typename T>
+void PilePersistante<T>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT((m_cardinalite == 0) == (m_sommet == nullptr));
+	INVARIANT(m_sommet == nullptr || m_sommet->m_references > 0);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Ajoute une référence à un noeud
+ * \param[in] p_noeud Le noeud, ou nullptr
+ * \return p_noeud
+ */
+template<typename T>
+typename PilePersistante<T>::elem PilePersistante<T>::_retenir(elem p_noeud)
+{
+	if (p_noeud != nullptr)
+		++p_noeud->m_references;
+	return p_noeud;
+}
+
+/**
+ * \brief Retire une référence à un noeud et libère la partie de la chaîne qui n'est plus atteinte
+ *
+ * La libération est itérative: elle s'arrête au premier noeud encore
+ * partagé avec une autre version.
+ *
+ * \param[in] p_noeud Le noeud, ou nullptr
+ */
+template<typename T>
+void PilePersistante<T>::_relacher(elem p_noeud)
+{
+	while (p_noeud != nullptr && --p_noeud->m_references == 0)
+	{
+		elem suivant = p_noeud->m_suivant;
+		delete p_noeud;
+		p_noeud = suivant;
+	}
+}
+
+} //Fin du namespace
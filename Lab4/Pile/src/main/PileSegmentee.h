@@ -0,0 +1,97 @@
+/**
+ * \file PileSegmentee.h
+ * \brief Classe définissant le type abstrait pile, par segments
+ * \version 0.1
+ *
+ * Représentation dans un tampon de N éléments intégré à l'objet, suivi
+ * d'une chaîne de segments de taille fixe alloués au besoin
+ */
+
+#ifndef PILESEGMENTEE_H
+#define PILESEGMENTEE_H
+
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace lab04
+{
+/**
+ * \class PileSegmentee
+ *
+ * \brief Classe générique représentant une Pile par segments.
+ *
+ *  Même interface que Pile. Les N premiers éléments vont dans un tampon
+ *  intégré à l'objet: une pile locale peu profonde n'alloue rien. Au-delà,
+ *  les éléments vont dans des segments de TAILLE_SEGMENT éléments. Un
+ *  segment vidé n'est pas libéré: il reste chaîné et sera réutilisé quand
+ *  la pile regrandira, de sorte qu'une profondeur qui oscille autour d'une
+ *  frontière de segment n'alloue qu'une fois. Aucun élément n'est jamais
+ *  déplacé pour agrandir la pile. Les segments sont libérés par le
+ *  destructeur.
+ */
+template<typename T, int N = 32, int TAILLE_SEGMENT = 256>
+class PileSegmentee
+{
+public:
+	PileSegmentee();
+	PileSegmentee(const PileSegmentee &);
+	~PileSegmentee();
+
+	void empiler(const T &);
+	T depiler();
+
+	bool estVide() const;
+	int taille() const;
+	const T& top() const;
+
+	T operator[](const int &) const;
+	const PileSegmentee<T, N, TAILLE_SEGMENT> & operator =(
+			const PileSegmentee<T, N, TAILLE_SEGMENT> &);
+
+	void verifieInvariant() const;
+
+	template<typename U, int M, int S> friend std::ostream& operator <<(std::ostream &,
+			const PileSegmentee<U, M, S> &);
+
+private:
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type case_t;
+
+	/**
+	 * \class Segment
+	 *
+	 * \brief Classe interne représentant un segment alloué, chaîné à ses voisins.
+	 */
+	class Segment
+	{
+	public:
+		case_t m_cases[TAILLE_SEGMENT]; /*!<Les éléments, construits de 0 à la position courante*/
+		Segment * m_precedent; /*!<Le segment plus près du fond, nullptr pour le tampon intégré*/
+		Segment * m_suivant; /*!<Le segment plus près du sommet, conservé même vide*/
+
+		explicit Segment(Segment * prev_ptr) :
+			m_precedent(prev_ptr), m_suivant(nullptr)
+		{
+		}
+	};
+
+	case_t m_enLigne[N]; /*!<Le tampon intégré, premier segment de la pile*/
+	Segment * m_segment; /*!<Le segment qui contient le sommet, nullptr pour le tampon intégré*/
+	Segment * m_premier; /*!<Le premier segment alloué, début de la chaîne*/
+	int m_position; /*!<Nombre d'éléments dans le segment courant*/
+	int m_cardinalite; /*!<Cardinalité de la pile*/
+
+	// Méthodes privées
+	T * _case(Segment *, int) const;
+	static int _capacite(const Segment *);
+	void _vider();
+	void _detruire();
+	void _copier(const PileSegmentee<T, N, TAILLE_SEGMENT> &);
+};
+} //Fin du namespace
+
+#include "PileSegmentee.hpp"
+
+#endif
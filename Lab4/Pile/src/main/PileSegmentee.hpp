@@ -0,0 +1,311 @@
+#include "ContratException.h"
+
+namespace lab04
+{
+
+/**
+ * \brief Affiche la pile, du sommet vers le fond
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+std::ostream & operator <<(std::ostream & p_out,
+		const PileSegmentee<T, N, TAILLE_SEGMENT> & p_source)
+{
+	typedef typename PileSegmentee<T, N, TAILLE_SEGMENT>::Segment Segment;
+
+	p_out << "Pile: [";
+	Segment * segment = p_source.m_segment;
+	int position = p_source.m_position;
+	for (int restants = p_source.m_cardinalite; restants > 0; --restants)
+	{
+		if (position == 0)
+		{
+			segment = segment->m_precedent;
+			position = PileSegmentee<T, N, TAILLE_SEGMENT>::_capacite(segment);
+		}
+		p_out << *p_source._case(segment, --position);
+		if (restants > 1)
+			p_out << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \post La pile est vide et n'a alloué aucun segment
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+PileSegmentee<T, N, TAILLE_SEGMENT>::PileSegmentee() :
+	m_segment(nullptr), m_premier(nullptr), m_position(0), m_cardinalite(0)
+{
+	static_assert(N > 0 && TAILLE_SEGMENT > 0, "PileSegmentee: les segments ne peuvent pas être vides");
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La pile à copier
+ * \post La pile est une copie profonde de p_source
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+PileSegmentee<T, N, TAILLE_SEGMENT>::PileSegmentee(const PileSegmentee & p_source) :
+	m_segment(nullptr), m_premier(nullptr), m_position(0), m_cardinalite(0)
+{
+	try
+	{
+		_copier(p_source);
+	}
+	catch (...)
+	{
+		_detruire();
+		throw;
+	}
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+PileSegmentee<T, N, TAILLE_SEGMENT>::~PileSegmentee()
+{
+	_detruire();
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile
+ *
+ * Si le segment courant est plein, le segment suivant de la chaîne est
+ * réutilisé; il n'est alloué que s'il n'existe pas encore.
+ *
+ * \param[in] p_el L'élément à empiler
+ * \post L'élément est au sommet
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+void PileSegmentee<T, N, TAILLE_SEGMENT>::empiler(const T & p_el)
+{
+	if (m_position == _capacite(m_segment))
+	{
+		Segment * suivant = m_segment == nullptr ? m_premier : m_segment->m_suivant;
+		if (suivant == nullptr)
+		{
+			suivant = new Segment(m_segment);
+			if (m_segment == nullptr)
+				m_premier = suivant;
+			else
+				m_segment->m_suivant = suivant;
+		}
+		new (_case(suivant, 0)) T(p_el);
+		m_segment = suivant;
+		m_position = 1;
+	}
+	else
+	{
+		new (_case(m_segment, m_position)) T(p_el);
+		++m_position;
+	}
+	++m_cardinalite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile
+ *
+ * Un segment vidé reste chaîné pour le prochain empiler.
+ *
+ * \return L'élément retiré
+ * \pre La pile n'est pas vide
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+T PileSegmentee<T, N, TAILLE_SEGMENT>::depiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	T * sommet = _case(m_segment, --m_position);
+	T el(std::move(*sommet));
+	sommet->~T();
+	if (m_position == 0 && m_segment != nullptr)
+	{
+		m_segment = m_segment->m_precedent;
+		m_position = _capacite(m_segment);
+	}
+	--m_cardinalite;
+
+	INVARIANTS();
+	return el;
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+bool PileSegmentee<T, N, TAILLE_SEGMENT>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+int PileSegmentee<T, N, TAILLE_SEGMENT>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Retourne l'élément au sommet sans le retirer
+ * \pre La pile n'est pas vide
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+const T & PileSegmentee<T, N, TAILLE_SEGMENT>::top() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return *_case(m_segment, m_position - 1);
+}
+
+/**
+ * \brief Retourne l'élément à une profondeur donnée, 0 étant le sommet
+ *
+ * Le parcours saute d'un segment entier à la fois.
+ *
+ * \param[in] p_index La profondeur
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+T PileSegmentee<T, N, TAILLE_SEGMENT>::operator[](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	Segment * segment = m_segment;
+	int position = m_position;
+	int profondeur = p_index;
+	while (profondeur >= position)
+	{
+		profondeur -= position;
+		segment = segment->m_precedent;
+		position = _capacite(segment);
+	}
+	return *_case(segment, position - 1 - profondeur);
+}
+
+/**
+ * \brief Opérateur d'assignation
+ *
+ * Les segments déjà alloués par la pile courante sont réutilisés.
+ *
+ * \param[in] p_source La pile à copier
+ * \return La pile courante, devenue une copie profonde de p_source
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+const PileSegmentee<T, N, TAILLE_SEGMENT> & PileSegmentee<T, N, TAILLE_SEGMENT>::operator =(
+		const PileSegmentee<T, N, TAILLE_SEGMENT> & p_source)
+{
+	if (this != &p_source)
+	{
+		_vider();
+		_copier(p_source);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité, le segment courant et la position
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+void PileSegmentee<T, N, TAILLE_SEGMENT>::verifieInvariant() const
+{
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT(m_position >= 0 && m_position <= _capacite(m_segment));
+	INVARIANT(m_segment == nullptr || m_position > 0);
+	INVARIANT((m_segment == nullptr) == (m_cardinalite <= N));
+	INVARIANT(m_segment != nullptr || m_position == m_cardinalite);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Retourne l'adresse d'une case d'un segment
+ * \param[in] p_segment Le segment, nullptr pour le tampon intégré
+ * \param[in] p_position L'indice de la case dans le segment
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+T * PileSegmentee<T, N, TAILLE_SEGMENT>::_case(Segment * p_segment, int p_position) const
+{
+	const case_t * cases = p_segment == nullptr ? m_enLigne : p_segment->m_cases;
+	return reinterpret_cast<T *>(const_cast<case_t *>(cases + p_position));
+}
+
+/**
+ * \brief Retourne la capacité d'un segment
+ * \param[in] p_segment Le segment, nullptr pour le tampon intégré
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+int PileSegmentee<T, N, TAILLE_SEGMENT>::_capacite(const Segment * p_segment)
+{
+	return p_segment == nullptr ? N : TAILLE_SEGMENT;
+}
+
+/**
+ * \brief Détruit tous les éléments en gardant les segments
+ * \post La pile est vide et son sommet est dans le tampon intégré
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+void PileSegmentee<T, N, TAILLE_SEGMENT>::_vider()
+{
+	while (m_cardinalite > 0)
+	{
+		_case(m_segment, --m_position)->~T();
+		if (m_position == 0 && m_segment != nullptr)
+		{
+			m_segment = m_segment->m_precedent;
+			m_position = _capacite(m_segment);
+		}
+		--m_cardinalite;
+	}
+}
+
+/**
+ * \brief Détruit tous les éléments et libère tous les segments
+ * \post La pile est vide et n'a plus aucun segment
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+void PileSegmentee<T, N, TAILLE_SEGMENT>::_detruire()
+{
+	_vider();
+	while (m_premier != nullptr)
+	{
+		Segment * suivant = m_premier->m_suivant;
+		delete m_premier;
+		m_premier = suivant;
+	}
+}
+
+/**
+ * \brief Empile une copie des éléments d'une autre pile, du fond au sommet
+ * \param[in] p_source La pile à copier
+ * \pre La pile courante est vide
+ */
+template<typename T, int N, int TAILLE_SEGMENT>
+void PileSegmentee<T, N, TAILLE_SEGMENT>::_copier(const PileSegmentee<T, N, TAILLE_SEGMENT> & p_source)
+{
+	Segment * segment = nullptr;
+	Segment * suivant = p_source.m_premier;
+	for (int restants = p_source.m_cardinalite; restants > 0;)
+	{
+		int nombre = segment == p_source.m_segment ? p_source.m_position : _capacite(segment);
+		for (int i = 0; i < nombre; ++i, --restants)
+		{
+			empiler(*p_source._case(segment, i));
+		}
+		segment = suivant;
+		if (suivant != nullptr)
+			suivant = suivant->m_suivant;
+	}
+}
+
+} //Fin du namespace
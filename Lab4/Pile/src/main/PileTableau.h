@@ -0,0 +1,64 @@
+/**
+ * \file PileTableau.h
+ * \brief Classe définissant le type abstrait pile
+ * \version 0.1
+ *
+ * Représentation dans un tableau dynamique
+ */
+
+#ifndef PILETABLEAU_H
+#define PILETABLEAU_H
+
+#include <iostream>
+#include <stdexcept>
+
+namespace lab04
+{
+/**
+ * \class PileTableau
+ *
+ * \brief Classe générique représentant une Pile.
+ *
+ *  Même interface que Pile, mais les éléments sont contigus dans un
+ *  tableau dynamique dont la capacité double lorsqu'il est plein:
+ *  empiler est en O(1) amorti, depiler et operator[] en O(1), et aucune
+ *  allocation n'a lieu tant que la capacité suffit.
+ */
+template<typename T>
+class PileTableau
+{
+public:
+	PileTableau(const int = CAPACITE_INITIALE);
+	PileTableau(const PileTableau &);
+	~PileTableau();
+
+	void empiler(const T &);
+	T depiler();
+
+	bool estVide() const;
+	int taille() const;
+	const T& top() const;
+
+	T operator[](const int &) const;
+	const PileTableau<T> & operator =(const PileTableau<T> &);
+
+	void verifieInvariant() const;
+
+	template<typename U> friend std::ostream& operator <<(std::ostream &,
+			const PileTableau<U> &);
+
+private:
+	T * m_tab; /*!<Tableau contenant la pile, le sommet à m_cardinalite - 1*/
+	int m_tailleMax; /*!<Capacité courante du tableau*/
+	int m_cardinalite; /*!<Cardinalité de la pile*/
+	static const int CAPACITE_INITIALE = 16; /*!<Capacité de la pile par défaut*/
+
+	// Méthodes privées
+	void _agrandir();
+	void _copier(const PileTableau<T> &);
+};
+} //Fin du namespace
+
+#include "PileTableau.hpp"
+
+#endif
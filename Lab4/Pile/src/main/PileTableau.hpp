@@ -0,0 +1,217 @@
+#include <utility>
+#include "ContratException.h"
+#include "PileTableau.h"
+
+
+namespace lab04 {
+
+template<typename T>
+std::ostream & operator <<(std::ostream & p_out, const PileTableau<T> & p_source)
+{
+	p_out << "Pile: [";
+	for (int i = p_source.m_cardinalite - 1; i >= 0; --i)
+	{
+		p_out << p_source.m_tab[i];
+		if (i > 0)
+			p_out << ",";
+	}
+	p_out << "]";
+	return p_out;
+}
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \param[in] p_capacite La capacité initiale du tableau
+ * \pre La capacité est positive
+ * \post La pile est vide
+ */
+template<typename T>
+PileTableau<T>::PileTableau(const int p_capacite) :
+	m_tab(nullptr), m_tailleMax(p_capacite), m_cardinalite(0)
+{
+	PRECONDITION(p_capacite > 0);
+
+	m_tab = new T[m_tailleMax];
+
+	POSTCONDITION(m_cardinalite == 0);
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de copie
+ * \param[in] p_source La pile à copier
+ * \post La pile est une copie profonde de p_source
+ */
+template<typename T>
+PileTableau<T>::PileTableau(const PileTableau & p_source) :
+	m_tab(nullptr), m_tailleMax(0), m_cardinalite(0)
+{
+	_copier(p_source);
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur
+ */
+template<typename T>
+PileTableau<T>::~PileTableau()
+{
+	delete[] m_tab;
+}
+
+/**
+ * \brief Ajoute un élément au sommet de la pile
+ *
+ * La capacité double si le tableau est plein.
+ *
+ * \param[in] p_el L'élément à empiler
+ * \post L'élément est au sommet
+ */
+template<typename T>
+void PileTableau<T>::empiler(const T & p_el)
+{
+	if (m_cardinalite == m_tailleMax)
+	{
+		_agrandir();
+	}
+	m_tab[m_cardinalite++] = p_el;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire l'élément au sommet de la pile
+ * \return L'élément retiré
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+T PileTableau<T>::depiler()
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	--m_cardinalite;
+
+	INVARIANTS();
+	return std::move(m_tab[m_cardinalite]);
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ */
+template<typename T>
+bool PileTableau<T>::estVide() const
+{
+	return m_cardinalite == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ */
+template<typename T>
+int PileTableau<T>::taille() const
+{
+	return m_cardinalite;
+}
+
+/**
+ * \brief Retourne l'élément au sommet sans le retirer
+ * \pre La pile n'est pas vide
+ */
+template<typename T>
+const T & PileTableau<T>::top() const
+{
+	PRECONDITION(m_cardinalite > 0);
+
+	return m_tab[m_cardinalite - 1];
+}
+
+/**
+ * \brief Retourne l'élément à une profondeur donnée, 0 étant le sommet, en O(1)
+ * \param[in] p_index La profondeur
+ * \pre 0 <= p_index < taille()
+ */
+template<typename T>
+T PileTableau<T>::operator[](const int & p_index) const
+{
+	PRECONDITION(p_index >= 0);
+	PRECONDITION(p_index < m_cardinalite);
+
+	return m_tab[m_cardinalite - 1 - p_index];
+}
+
+/**
+ * \brief Opérateur d'assignation
+ * \param[in] p_source La pile à copier
+ * \return La pile courante, devenue une copie profonde de p_source
+ */
+template<typename T>
+const PileTableau<T> & PileTableau<T>::operator =(const PileTableau<T> & p_source)
+{
+	if (this != &p_source)
+	{
+		_copier(p_source);
+	}
+	INVARIANTS();
+	return *this;
+}
+
+/**
+ * \brief Vérifie la cohérence entre la cardinalité et la capacité
+ */
+template<typename T>
+void PileTableau<T>::verifieInvariant() const
+{
+	INVARIANT(m_tab != nullptr);
+	INVARIANT(m_cardinalite >= 0);
+	INVARIANT(m_cardinalite <= m_tailleMax);
+}
+
+// Méthodes privées
+
+/**
+ * \brief Double la capacité du tableau en y déplaçant les éléments
+ */
+template<typename T>
+void PileTableau<T>::_agrandir()
+{
+	T * nouveau = new T[m_tailleMax * 2];
+	for (int i = 0; i < m_cardinalite; ++i)
+	{
+		nouveau[i] = std::move(m_tab[i]);
+	}
+	delete[] m_tab;
+	m_tab = nouveau;
+	m_tailleMax *= 2;
+}
+
+/**
+ * \brief Remplace le contenu par une copie des éléments d'une autre pile
+ *
+ * La capacité de la copie est celle de la source. L'ancien tableau n'est
+ * libéré qu'une fois la copie réussie.
+ *
+ * \param[in] p_source La pile à copier
+ */
+template<typename T>
+void PileTableau<T>::_copier(const PileTableau<T> & p_source)
+{
+	T * nouveau = new T[p_source.m_tailleMax];
+	try
+	{
+		for (int i = 0; i < p_source.m_cardinalite; ++i)
+		{
+			nouveau[i] = p_source.m_tab[i];
+		}
+	}
+	catch (...)
+	{
+		delete[] nouveau;
+		throw;
+	}
+	delete[] m_tab;
+	m_tab = nouveau;
+	m_tailleMax = p_source.m_tailleMax;
+	m_cardinalite = p_source.m_cardinalite;
+}
+
+} //Fin du namespace
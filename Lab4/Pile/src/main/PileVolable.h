@@ -0,0 +1,102 @@
+/**
+ * \file PileVolable.h
+ * \brief Classe définissant une pile de travail dont d'autres fils peuvent voler le fond
+ * \version 0.1
+ *
+ * Deque de Chase et Lev: le fil propriétaire empile et dépile au sommet
+ * (l'indice m_bas) sans opération atomique de lecture-modification-écriture,
+ * sauf pour disputer le dernier élément. Les autres fils volent au fond
+ * (l'indice m_haut) par compare-and-swap. Le tableau circulaire double
+ * lorsqu'il est plein; les anciens tableaux, qu'un voleur peut encore
+ * lire, ne sont libérés que par le destructeur.
+ */
+
+#ifndef PILEVOLABLE_H
+#define PILEVOLABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace lab04
+{
+/**
+ * \class PileVolable
+ *
+ * \brief Classe générique représentant la pile de tâches d'un fil de travail.
+ *
+ *  empiler et depiler ne doivent être appelés que par le fil propriétaire;
+ *  voler et estVide peuvent l'être par n'importe quel fil. Le propriétaire
+ *  reprend les éléments les plus récents (ordre LIFO) et les voleurs
+ *  prennent les plus anciens.
+ *
+ *  Les cases sont lues pendant qu'un autre fil peut les écrire: T doit
+ *  être trivialement copiable (typiquement un pointeur vers une tâche).
+ */
+template<typename T>
+class PileVolable
+{
+public:
+	explicit PileVolable(const int = CAPACITE_INITIALE);
+	~PileVolable();
+
+	void empiler(const T &);
+	bool depiler(T &);
+	bool voler(T &);
+
+	bool estVide() const;
+	int taille() const;
+
+private:
+	PileVolable(const PileVolable &);
+	const PileVolable<T> & operator =(const PileVolable<T> &);
+
+	typedef std::int64_t indice;
+
+	/**
+	 * \class Tableau
+	 *
+	 * \brief Classe interne représentant un tableau circulaire de capacité 2^k.
+	 */
+	class Tableau
+	{
+	public:
+		const indice m_capacite; /*!<Nombre de cases, une puissance de 2*/
+		std::atomic<T> * const m_cases; /*!<Les cases, indicées modulo m_capacite*/
+		Tableau * const m_precedent; /*!<Le tableau remplacé, conservé pour les voleurs*/
+
+		Tableau(indice capacite, Tableau * prev_ptr) :
+			m_capacite(capacite), m_cases(new std::atomic<T>[capacite]), m_precedent(prev_ptr)
+		{
+		}
+
+		~Tableau()
+		{
+			delete[] m_cases;
+		}
+
+		T lire(indice i) const
+		{
+			return m_cases[i & (m_capacite - 1)].load(std::memory_order_relaxed);
+		}
+
+		void ecrire(indice i, const T & el)
+		{
+			m_cases[i & (m_capacite - 1)].store(el, std::memory_order_relaxed);
+		}
+	};
+
+	static const int CAPACITE_INITIALE = 64; /*!<Capacité par défaut*/
+
+	std::atomic<indice> m_haut; /*!<Indice du plus ancien élément, où volent les autres fils*/
+	std::atomic<indice> m_bas; /*!<Indice suivant le plus récent élément, réservé au propriétaire*/
+	std::atomic<Tableau *> m_tableau; /*!<Le tableau courant*/
+
+	// Méthodes privées
+	Tableau * _agrandir(Tableau *, indice, indice);
+};
+} //Fin du namespace
+
+#include "PileVolable.hpp"
+
+#endif
@@ -0,0 +1,183 @@
+#include "ContratException.h"
+
+namespace lab04
+{
+
+/**
+ * \brief Constructeur d'une pile vide
+ * \param[in] p_capacite La capacité initiale, arrondie à la puissance de 2 supérieure
+ * \pre p_capacite > 0
+ * \post La pile est vide
+ */
+template<typename T>
+PileVolable<T>::PileVolable(const int p_capacite) :
+	m_haut(0), m_bas(0), m_tableau(nullptr)
+{
+	static_assert(std::is_trivially_copyable<T>::value,
+			"PileVolable: les éléments doivent être trivialement copiables");
+	PRECONDITION(p_capacite > 0);
+
+	indice capacite = 1;
+	while (capacite < p_capacite)
+		capacite *= 2;
+	m_tableau.store(new Tableau(capacite, nullptr));
+}
+
+/**
+ * \brief Destructeur
+ * \pre Aucun autre fil n'utilise la pile
+ */
+template<typename T>
+PileVolable<T>::~PileVolable()
+{
+	Tableau * tableau = m_tableau.load();
+	while (tableau != nullptr)
+	{
+		Tableau * precedent = tableau->m_precedent;
+		delete tableau;
+		tableau = precedent;
+	}
+}
+
+/**
+ * \brief Ajoute un élément au sommet, du côté du propriétaire
+ *
+ * Seul m_bas est publié, par une écriture simple: aucun compare-and-swap.
+ *
+ * \param[in] p_el L'élément à empiler
+ * \pre Appelé par le fil propriétaire
+ */
+template<typename T>
+void PileVolable<T>::empiler(const T & p_el)
+{
+	indice bas = m_bas.load(std::memory_order_relaxed);
+	indice haut = m_haut.load(std::memory_order_acquire);
+	Tableau * tableau = m_tableau.load(std::memory_order_relaxed);
+	if (bas - haut > tableau->m_capacite - 1)
+	{
+		tableau = _agrandir(tableau, haut, bas);
+	}
+	tableau->ecrire(bas, p_el);
+	std::atomic_thread_fence(std::memory_order_release);
+	m_bas.store(bas + 1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retire l'élément le plus récent, du côté du propriétaire
+ *
+ * Un compare-and-swap n'est nécessaire que lorsqu'il reste un seul
+ * élément, que les voleurs peuvent aussi disputer.
+ *
+ * \param[out] p_el Reçoit l'élément dépilé, inchangé si false est retourné
+ * \return true si un élément a été dépilé, false si la pile était vide
+ *         ou si un voleur a pris le dernier élément
+ * \pre Appelé par le fil propriétaire
+ */
+template<typename T>
+bool PileVolable<T>::depiler(T & p_el)
+{
+	indice bas = m_bas.load(std::memory_order_relaxed) - 1;
+	Tableau * tableau = m_tableau.load(std::memory_order_relaxed);
+	m_bas.store(bas, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	indice haut = m_haut.load(std::memory_order_relaxed);
+
+	if (haut > bas)
+	{
+		m_bas.store(bas + 1, std::memory_order_relaxed);
+		return false;
+	}
+
+	T el = tableau->lire(bas);
+	if (haut < bas)
+	{
+		p_el = el;
+		return true;
+	}
+
+	bool gagne = m_haut.compare_exchange_strong(haut, haut + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed);
+	m_bas.store(bas + 1, std::memory_order_relaxed);
+	if (gagne)
+		p_el = el;
+	return gagne;
+}
+
+/**
+ * \brief Prend l'élément le plus ancien, du côté des voleurs
+ *
+ * Un seul essai: si un autre fil prend l'élément en même temps, voler
+ * retourne false et l'appelant peut choisir une autre victime.
+ *
+ * \param[out] p_el Reçoit l'élément volé
+ * \return true si un élément a été volé
+ */
+template<typename T>
+bool PileVolable<T>::voler(T & p_el)
+{
+	indice haut = m_haut.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	indice bas = m_bas.load(std::memory_order_acquire);
+	if (haut >= bas)
+		return false;
+
+	Tableau * tableau = m_tableau.load(std::memory_order_acquire);
+	T el = tableau->lire(haut);
+	if (!m_haut.compare_exchange_strong(haut, haut + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed))
+		return false;
+	p_el = el;
+	return true;
+}
+
+/**
+ * \brief Vérifie si la pile est vide
+ *
+ * Sous accès concurrent, la réponse est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+bool PileVolable<T>::estVide() const
+{
+	return taille() == 0;
+}
+
+/**
+ * \brief Retourne le nombre d'éléments
+ *
+ * Sous accès concurrent, la valeur est un instantané qui peut déjà être périmé.
+ */
+template<typename T>
+int PileVolable<T>::taille() const
+{
+	indice bas = m_bas.load(std::memory_order_acquire);
+	indice haut = m_haut.load(std::memory_order_acquire);
+	return bas > haut ? static_cast<int>(bas - haut) : 0;
+}
+
+// Méthodes privées
+
+/**
+ * \brief Remplace le tableau plein par un tableau deux fois plus grand
+ *
+ * Les éléments de haut à bas sont recopiés aux mêmes indices logiques.
+ * L'ancien tableau reste chaîné au nouveau pour les voleurs qui le lisent.
+ *
+ * \param[in] p_ancien Le tableau plein
+ * \param[in] p_haut L'indice du plus ancien élément
+ * \param[in] p_bas L'indice suivant le plus récent élément
+ * \return Le nouveau tableau, déjà publié
+ */
+template<typename T>
+typename PileVolable<T>::Tableau * PileVolable<T>::_agrandir(Tableau * p_ancien,
+		indice p_haut, indice p_bas)
+{
+	Tableau * nouveau = new Tableau(p_ancien->m_capacite * 2, p_ancien);
+	for (indice i = p_haut; i < p_bas; ++i)
+	{
+		nouveau->ecrire(i, p_ancien->lire(i));
+	}
+	m_tableau.store(nouveau, std::memory_order_release);
+	return nouveau;
+}
+
+} //Fin du namespace
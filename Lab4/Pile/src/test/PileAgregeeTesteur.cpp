@@ -0,0 +1,240 @@
+/**
+ * \file PileAgregeeTesteur.cpp
+ * \brief Tests unitaires pour PileAgregee
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PileAgregee.
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PileAgregee.h"
+#include "../main/Comparable.h"
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+static const Comparable c1(1, "bleu");
+static const Comparable c2(2, "rouge");
+static const Comparable c3(3, "vert");
+static const Comparable c4(4, "jaune");
+
+using namespace lab04;
+
+struct PileAgregeeTest: public ::testing::Test {
+	virtual void SetUp() {
+		pile2.empiler(c1);
+		pile2.empiler(c2);
+		pile2.empiler(c3);
+		pile2.empiler(c4);
+	}
+	// virtual void TearDown() {}
+	PileAgregee<Comparable> pile1;
+	PileAgregee<Comparable> pile2;
+};
+
+TEST_F(PileAgregeeTest, ajoutUnElementOk) {
+	pile1.empiler(c4);
+	EXPECT_FALSE(pile1.estVide());
+	EXPECT_EQ(1, pile1.taille());
+}
+
+TEST_F(PileAgregeeTest, ajoutTroisElementOk) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	EXPECT_EQ(1, pile1.taille());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	EXPECT_EQ(2, pile1.taille());
+	pile1.empiler(c3);
+	EXPECT_EQ(c3, pile1.top());
+	EXPECT_EQ(3, pile1.taille());
+}
+
+TEST_F(PileAgregeeTest, ajoutUnElementEnleveUnElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileAgregeeTest, ajoutTroisElementEnleveTroisElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	pile1.empiler(c3);
+	EXPECT_EQ(3, pile1.taille());
+	EXPECT_EQ(c3, pile1.depiler());
+	EXPECT_EQ(2, pile1.taille());
+	EXPECT_EQ(c2, pile1.depiler());
+	EXPECT_EQ(1, pile1.taille());
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileAgregeeTest, TestCaseBracketOperator1elem) {
+	pile1.empiler(c1);
+	EXPECT_TRUE(c1 == pile1[0]);
+}
+
+TEST_F(PileAgregeeTest, TestCaseBracketOperator3elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	EXPECT_TRUE(c3 == pile1[0]);
+	EXPECT_TRUE(c2 == pile1[1]);
+	EXPECT_TRUE(c1 == pile1[2]);
+}
+
+TEST_F(PileAgregeeTest, TestCaseOperatorEqual1ElemEach) {
+	pile1.empiler(c1);
+	PileAgregee<Comparable> autre;
+	autre.empiler(c1);
+	autre = pile1;
+	EXPECT_TRUE(c1 == pile1.top());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileAgregeeTest, TestCaseOperatorEqual3) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileAgregee<Comparable> autre;
+	autre = pile1;
+	EXPECT_EQ(3, autre.taille());
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileAgregeeTest, TestCaseCopyConst1ElemEach) {
+	pile1.empiler(c1);
+	PileAgregee<Comparable> autre(pile1);
+	EXPECT_EQ(1, autre.taille());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileAgregeeTest, TestCaseCopyConst3Elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileAgregee<Comparable> autre(pile1);
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileAgregeeTest, TestCaseOperatorOstream) {
+	std::ostringstream oss;
+
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	oss << pile1;
+
+	std::string expected =
+			"Pile: [Valeur->3     Mot->vert\n,Valeur->2     Mot->rouge\n,Valeur->1     Mot->bleu\n]";
+	EXPECT_EQ(expected, oss.str());
+}
+
+TEST_F(PileAgregeeTest, depilerPileVideLanceLogicError) {
+	PileAgregee<int> pileVide;
+	EXPECT_THROW(pileVide.depiler(), PreconditionException);
+}
+
+TEST_F(PileAgregeeTest, topPileVideLanceLogicError) {
+	PileAgregee<int> pileVide;
+	EXPECT_THROW(pileVide.top(), PreconditionException);
+}
+
+TEST_F(PileAgregeeTest, operatorCrochetErreur) {
+	PileAgregee<int> unePile;
+	unePile.empiler(5);
+	EXPECT_THROW(unePile[-1], PreconditionException);
+	EXPECT_THROW(unePile[2], PreconditionException);
+}
+
+
+TEST_F(PileAgregeeTest, minMaxAgregatSuiventLesOperations) {
+	PileAgregee<int> pile;
+	pile.empiler(5);
+	EXPECT_EQ(5, pile.min());
+	EXPECT_EQ(5, pile.max());
+	EXPECT_EQ(5, pile.agregat());
+	pile.empiler(2);
+	pile.empiler(9);
+	pile.empiler(4);
+	EXPECT_EQ(2, pile.min());
+	EXPECT_EQ(9, pile.max());
+	EXPECT_EQ(20, pile.agregat());
+	pile.depiler();
+	pile.depiler();
+	EXPECT_EQ(2, pile.min());
+	EXPECT_EQ(5, pile.max());
+	EXPECT_EQ(7, pile.agregat());
+	pile.depiler();
+	EXPECT_EQ(5, pile.min());
+	EXPECT_EQ(5, pile.agregat());
+}
+
+TEST_F(PileAgregeeTest, agregatsDeComparable) {
+	EXPECT_EQ(c1, pile2.min());
+	EXPECT_EQ(c4, pile2.max());
+	EXPECT_EQ(10, pile2.agregat().reqValeur());
+	PileAgregee<Comparable> copie(pile2);
+	copie.depiler();
+	EXPECT_EQ(c3, copie.max());
+	EXPECT_EQ(c4, pile2.max());
+}
+
+/**
+ * \brief Repli non commutatif: l'ordre du fond vers le sommet est respecté
+ */
+struct Concatenation {
+	std::string operator()(const std::string & p_gauche, const std::string & p_droite) const {
+		return p_gauche + p_droite;
+	}
+};
+
+TEST_F(PileAgregeeTest, repliFourniParLUtilisateur) {
+	PileAgregee<std::string, Concatenation> mots;
+	mots.empiler("a");
+	mots.empiler("b");
+	mots.empiler("c");
+	EXPECT_EQ("abc", mots.agregat());
+	mots.depiler();
+	EXPECT_EQ("ab", mots.agregat());
+}
+
+TEST_F(PileAgregeeTest, maximumFenetreGlissanteParDeuxPiles) {
+	const int fenetre = 5;
+	std::vector<int> valeurs;
+	for (int i = 0; i < 200; ++i)
+		valeurs.push_back((i * 37) % 101);
+
+	PileAgregee<int> entree;
+	PileAgregee<int> sortie;
+	for (std::size_t i = 0; i < valeurs.size(); ++i) {
+		entree.empiler(valeurs[i]);
+		if (static_cast<int>(i) >= fenetre) {
+			if (sortie.estVide())
+				while (!entree.estVide())
+					sortie.empiler(entree.depiler());
+			sortie.depiler();
+		}
+		if (static_cast<int>(i) >= fenetre - 1) {
+			int maximum = entree.estVide() ? sortie.max()
+					: sortie.estVide() ? entree.max()
+					: std::max(entree.max(), sortie.max());
+			EXPECT_EQ(*std::max_element(valeurs.begin() + (i + 1 - fenetre), valeurs.begin() + i + 1),
+					maximum);
+		}
+	}
+}
+
+TEST_F(PileAgregeeTest, agregatsPileVideLancentLogicError) {
+	EXPECT_THROW(pile1.min(), PreconditionException);
+	EXPECT_THROW(pile1.max(), PreconditionException);
+	EXPECT_THROW(pile1.agregat(), PreconditionException);
+}
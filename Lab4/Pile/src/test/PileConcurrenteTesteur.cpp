@@ -0,0 +1,153 @@
+/**
+ * \file PileConcurrenteTesteur.cpp
+ * \brief Les tests unitaires de PileConcurrente.
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PileConcurrente
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PileConcurrente.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+static const int NB_FILS = 8;
+static const int NB_PAR_FIL = 20000;
+
+class PileConcurrenteTest: public ::testing::Test
+{
+protected:
+	virtual void SetUp() {
+		pile.empiler(1);
+		pile.empiler(2);
+		pile.empiler(3);
+	}
+	PileConcurrente<int> pileVide;
+	PileConcurrente<int> pile;
+};
+
+TEST_F(PileConcurrenteTest, constructeurVideOK)
+{
+	int el = 0;
+	EXPECT_TRUE(pileVide.estVide());
+	EXPECT_FALSE(pileVide.depiler(el));
+}
+
+TEST_F(PileConcurrenteTest, depilerOrdreLIFO)
+{
+	int el = 0;
+	EXPECT_FALSE(pile.estVide());
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(3, el);
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(2, el);
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(1, el);
+	EXPECT_TRUE(pile.estVide());
+	EXPECT_FALSE(pile.depiler(el));
+}
+
+TEST_F(PileConcurrenteTest, noeudsRecyclesGardentLesElements)
+{
+	PileConcurrente<std::string> chaines;
+	std::string el;
+	for (int tour = 0; tour < 3; ++tour)
+	{
+		chaines.empiler("premier");
+		chaines.empiler("second");
+		EXPECT_TRUE(chaines.depiler(el));
+		EXPECT_EQ("second", el);
+		EXPECT_TRUE(chaines.depiler(el));
+		EXPECT_EQ("premier", el);
+	}
+	chaines.empiler("restant");
+}
+
+TEST_F(PileConcurrenteTest, destructeurDetruitLesElementsRestants)
+{
+	std::shared_ptr<int> partage(new int(7));
+	{
+		PileConcurrente<std::shared_ptr<int> > pointeurs;
+		pointeurs.empiler(partage);
+		pointeurs.empiler(partage);
+		EXPECT_EQ(3, partage.use_count());
+	}
+	EXPECT_EQ(1, partage.use_count());
+}
+
+TEST_F(PileConcurrenteTest, empilerEtDepilerConcurrents)
+{
+	std::vector<std::vector<int> > recus(NB_FILS);
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		fils.push_back(std::thread([this, f, &recus]() {
+			for (int i = 0; i < NB_PAR_FIL; ++i)
+			{
+				pileVide.empiler(f * NB_PAR_FIL + i);
+				int el;
+				if (pileVide.depiler(el))
+					recus[f].push_back(el);
+			}
+		}));
+	}
+	for (std::size_t i = 0; i < fils.size(); ++i)
+		fils[i].join();
+
+	std::vector<bool> vus(NB_FILS * NB_PAR_FIL, false);
+	int total = 0;
+	for (int f = 0; f < NB_FILS; ++f)
+	{
+		for (std::size_t i = 0; i < recus[f].size(); ++i)
+		{
+			EXPECT_FALSE(vus[recus[f][i]]);
+			vus[recus[f][i]] = true;
+			++total;
+		}
+	}
+	int el;
+	while (pileVide.depiler(el))
+	{
+		EXPECT_FALSE(vus[el]);
+		vus[el] = true;
+		++total;
+	}
+	EXPECT_EQ(NB_FILS * NB_PAR_FIL, total);
+}
+
+TEST_F(PileConcurrenteTest, producteursEtConsommateurs)
+{
+	std::vector<long long> sommes(NB_FILS / 2, 0);
+	std::vector<int> comptes(NB_FILS / 2, 0);
+	std::vector<std::thread> fils;
+	for (int f = 0; f < NB_FILS / 2; ++f)
+	{
+		fils.push_back(std::thread([this, f]() {
+			for (int i = 1; i <= NB_PAR_FIL; ++i)
+				pileVide.empiler(i);
+		}));
+		fils.push_back(std::thread([this, f, &sommes, &comptes]() {
+			int el;
+			while (comptes[f] < NB_PAR_FIL)
+			{
+				if (pileVide.depiler(el))
+				{
+					sommes[f] += el;
+					++comptes[f];
+				}
+			}
+		}));
+	}
+	for (std::size_t i = 0; i < fils.size(); ++i)
+		fils[i].join();
+
+	long long total = 0;
+	for (std::size_t f = 0; f < sommes.size(); ++f)
+		total += sommes[f];
+	EXPECT_EQ((NB_FILS / 2) * (long long) NB_PAR_FIL * (NB_PAR_FIL + 1) / 2, total);
+	EXPECT_TRUE(pileVide.estVide());
+}
@@ -0,0 +1,205 @@
+/**
+ * \file PilePersistanteTesteur.cpp
+ * \brief Tests unitaires pour PilePersistante
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PilePersistante.
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PilePersistante.h"
+#include "../main/Comparable.h"
+#include <vector>
+
+static const Comparable c1(1, "bleu");
+static const Comparable c2(2, "rouge");
+static const Comparable c3(3, "vert");
+static const Comparable c4(4, "jaune");
+
+using namespace lab04;
+
+struct PilePersistanteTest: public ::testing::Test {
+	virtual void SetUp() {
+		pile2.empiler(c1);
+		pile2.empiler(c2);
+		pile2.empiler(c3);
+		pile2.empiler(c4);
+	}
+	// virtual void TearDown() {}
+	PilePersistante<Comparable> pile1;
+	PilePersistante<Comparable> pile2;
+};
+
+TEST_F(PilePersistanteTest, ajoutUnElementOk) {
+	pile1.empiler(c4);
+	EXPECT_FALSE(pile1.estVide());
+	EXPECT_EQ(1, pile1.taille());
+}
+
+TEST_F(PilePersistanteTest, ajoutTroisElementOk) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	EXPECT_EQ(1, pile1.taille());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	EXPECT_EQ(2, pile1.taille());
+	pile1.empiler(c3);
+	EXPECT_EQ(c3, pile1.top());
+	EXPECT_EQ(3, pile1.taille());
+}
+
+TEST_F(PilePersistanteTest, ajoutUnElementEnleveUnElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PilePersistanteTest, ajoutTroisElementEnleveTroisElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	pile1.empiler(c3);
+	EXPECT_EQ(3, pile1.taille());
+	EXPECT_EQ(c3, pile1.depiler());
+	EXPECT_EQ(2, pile1.taille());
+	EXPECT_EQ(c2, pile1.depiler());
+	EXPECT_EQ(1, pile1.taille());
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PilePersistanteTest, TestCaseBracketOperator1elem) {
+	pile1.empiler(c1);
+	EXPECT_TRUE(c1 == pile1[0]);
+}
+
+TEST_F(PilePersistanteTest, TestCaseBracketOperator3elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	EXPECT_TRUE(c3 == pile1[0]);
+	EXPECT_TRUE(c2 == pile1[1]);
+	EXPECT_TRUE(c1 == pile1[2]);
+}
+
+TEST_F(PilePersistanteTest, TestCaseOperatorEqual1ElemEach) {
+	pile1.empiler(c1);
+	PilePersistante<Comparable> autre;
+	autre.empiler(c1);
+	autre = pile1;
+	EXPECT_TRUE(c1 == pile1.top());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PilePersistanteTest, TestCaseOperatorEqual3) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PilePersistante<Comparable> autre;
+	autre = pile1;
+	EXPECT_EQ(3, autre.taille());
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PilePersistanteTest, TestCaseCopyConst1ElemEach) {
+	pile1.empiler(c1);
+	PilePersistante<Comparable> autre(pile1);
+	EXPECT_EQ(1, autre.taille());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PilePersistanteTest, TestCaseCopyConst3Elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PilePersistante<Comparable> autre(pile1);
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PilePersistanteTest, TestCaseOperatorOstream) {
+	std::ostringstream oss;
+
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	oss << pile1;
+
+	std::string expected =
+			"Pile: [Valeur->3     Mot->vert\n,Valeur->2     Mot->rouge\n,Valeur->1     Mot->bleu\n]";
+	EXPECT_EQ(expected, oss.str());
+}
+
+TEST_F(PilePersistanteTest, depilerPileVideLanceLogicError) {
+	PilePersistante<int> pileVide;
+	EXPECT_THROW(pileVide.depiler(), PreconditionException);
+}
+
+TEST_F(PilePersistanteTest, topPileVideLanceLogicError) {
+	PilePersistante<int> pileVide;
+	EXPECT_THROW(pileVide.top(), PreconditionException);
+}
+
+TEST_F(PilePersistanteTest, operatorCrochetErreur) {
+	PilePersistante<int> unePile;
+	unePile.empiler(5);
+	EXPECT_THROW(unePile[-1], PreconditionException);
+	EXPECT_THROW(unePile[2], PreconditionException);
+}
+
+
+TEST_F(PilePersistanteTest, copieInchangeeParEmpilerEtDepiler) {
+	PilePersistante<Comparable> version(pile2);
+	EXPECT_EQ(c4, pile2.depiler());
+	pile2.empiler(c1);
+	version.empiler(c2);
+
+	EXPECT_EQ(5, version.taille());
+	EXPECT_EQ(c2, version[0]);
+	EXPECT_EQ(c4, version[1]);
+	EXPECT_EQ(c1, version[4]);
+	EXPECT_EQ(4, pile2.taille());
+	EXPECT_EQ(c1, pile2[0]);
+	EXPECT_EQ(c3, pile2[1]);
+}
+
+TEST_F(PilePersistanteTest, retourArriereParVersions) {
+	std::vector<PilePersistante<int> > versions(1);
+	for (int i = 1; i <= 1000; ++i) {
+		versions.push_back(versions.back());
+		versions.back().empiler(i);
+	}
+	for (int i = 0; i <= 1000; ++i) {
+		EXPECT_EQ(i, versions[i].taille());
+		if (i > 0) {
+			EXPECT_EQ(i, versions[i].top());
+		}
+	}
+	versions.erase(versions.begin() + 1, versions.begin() + 500);
+	EXPECT_EQ(1000, versions.back().taille());
+	EXPECT_EQ(1, versions.back()[999]);
+}
+
+TEST_F(PilePersistanteTest, liberationDeLongueChaineSansRecursion) {
+	PilePersistante<int> longue;
+	for (int i = 0; i < 1000000; ++i)
+		longue.empiler(i);
+	PilePersistante<int> courte(longue);
+	for (int i = 0; i < 10; ++i)
+		courte.depiler();
+	longue = courte;
+	EXPECT_EQ(999989, longue.top());
+}
+
+TEST_F(PilePersistanteTest, autoAssignationOk) {
+	const PilePersistante<Comparable> & meme = pile2;
+	pile2 = meme;
+	EXPECT_EQ(4, pile2.taille());
+	EXPECT_EQ(c4, pile2.top());
+}
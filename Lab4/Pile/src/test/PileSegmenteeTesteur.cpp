@@ -0,0 +1,230 @@
+/**
+ * \file PileSegmenteeTesteur.cpp
+ * \brief Tests unitaires pour PileSegmentee
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PileSegmentee.
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PileSegmentee.h"
+#include "../main/Comparable.h"
+#include <memory>
+#include <sstream>
+
+static const Comparable c1(1, "bleu");
+static const Comparable c2(2, "rouge");
+static const Comparable c3(3, "vert");
+static const Comparable c4(4, "jaune");
+
+using namespace lab04;
+
+struct PileSegmenteeTest: public ::testing::Test {
+	virtual void SetUp() {
+		pile2.empiler(c1);
+		pile2.empiler(c2);
+		pile2.empiler(c3);
+		pile2.empiler(c4);
+	}
+	// virtual void TearDown() {}
+	PileSegmentee<Comparable> pile1;
+	PileSegmentee<Comparable> pile2;
+};
+
+TEST_F(PileSegmenteeTest, ajoutUnElementOk) {
+	pile1.empiler(c4);
+	EXPECT_FALSE(pile1.estVide());
+	EXPECT_EQ(1, pile1.taille());
+}
+
+TEST_F(PileSegmenteeTest, ajoutTroisElementOk) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	EXPECT_EQ(1, pile1.taille());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	EXPECT_EQ(2, pile1.taille());
+	pile1.empiler(c3);
+	EXPECT_EQ(c3, pile1.top());
+	EXPECT_EQ(3, pile1.taille());
+}
+
+TEST_F(PileSegmenteeTest, ajoutUnElementEnleveUnElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileSegmenteeTest, ajoutTroisElementEnleveTroisElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	pile1.empiler(c3);
+	EXPECT_EQ(3, pile1.taille());
+	EXPECT_EQ(c3, pile1.depiler());
+	EXPECT_EQ(2, pile1.taille());
+	EXPECT_EQ(c2, pile1.depiler());
+	EXPECT_EQ(1, pile1.taille());
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileSegmenteeTest, TestCaseBracketOperator1elem) {
+	pile1.empiler(c1);
+	EXPECT_TRUE(c1 == pile1[0]);
+}
+
+TEST_F(PileSegmenteeTest, TestCaseBracketOperator3elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	EXPECT_TRUE(c3 == pile1[0]);
+	EXPECT_TRUE(c2 == pile1[1]);
+	EXPECT_TRUE(c1 == pile1[2]);
+}
+
+TEST_F(PileSegmenteeTest, TestCaseOperatorEqual1ElemEach) {
+	pile1.empiler(c1);
+	PileSegmentee<Comparable> autre;
+	autre.empiler(c1);
+	autre = pile1;
+	EXPECT_TRUE(c1 == pile1.top());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileSegmenteeTest, TestCaseOperatorEqual3) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileSegmentee<Comparable> autre;
+	autre = pile1;
+	EXPECT_EQ(3, autre.taille());
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileSegmenteeTest, TestCaseCopyConst1ElemEach) {
+	pile1.empiler(c1);
+	PileSegmentee<Comparable> autre(pile1);
+	EXPECT_EQ(1, autre.taille());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileSegmenteeTest, TestCaseCopyConst3Elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileSegmentee<Comparable> autre(pile1);
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileSegmenteeTest, TestCaseOperatorOstream) {
+	std::ostringstream oss;
+
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	oss << pile1;
+
+	std::string expected =
+			"Pile: [Valeur->3     Mot->vert\n,Valeur->2     Mot->rouge\n,Valeur->1     Mot->bleu\n]";
+	EXPECT_EQ(expected, oss.str());
+}
+
+TEST_F(PileSegmenteeTest, depilerPileVideLanceLogicError) {
+	PileSegmentee<int> pileVide;
+	EXPECT_THROW(pileVide.depiler(), PreconditionException);
+}
+
+TEST_F(PileSegmenteeTest, topPileVideLanceLogicError) {
+	PileSegmentee<int> pileVide;
+	EXPECT_THROW(pileVide.top(), PreconditionException);
+}
+
+TEST_F(PileSegmenteeTest, operatorCrochetErreur) {
+	PileSegmentee<int> unePile;
+	unePile.empiler(5);
+	EXPECT_THROW(unePile[-1], PreconditionException);
+	EXPECT_THROW(unePile[2], PreconditionException);
+}
+
+
+typedef PileSegmentee<int, 4, 8> PetitePile;
+
+TEST_F(PileSegmenteeTest, traverseLesSegmentsDansLesDeuxSens) {
+	PetitePile pile;
+	for (int i = 0; i < 100; ++i) {
+		pile.empiler(i);
+		EXPECT_EQ(i, pile.top());
+	}
+	EXPECT_EQ(100, pile.taille());
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(99 - i, pile[i]);
+	for (int i = 99; i >= 0; --i)
+		EXPECT_EQ(i, pile.depiler());
+	EXPECT_TRUE(pile.estVide());
+}
+
+TEST_F(PileSegmenteeTest, oscillationAutourDUneFrontiere) {
+	PetitePile pile;
+	for (int i = 0; i < 12; ++i)
+		pile.empiler(i);
+	for (int tour = 0; tour < 50; ++tour) {
+		EXPECT_EQ(11, pile.depiler());
+		EXPECT_EQ(10, pile.depiler());
+		EXPECT_EQ(9, pile.depiler());
+		EXPECT_EQ(8, pile.top());
+		pile.empiler(9);
+		pile.empiler(10);
+		pile.empiler(11);
+	}
+	EXPECT_EQ(12, pile.taille());
+	EXPECT_EQ(0, pile[11]);
+}
+
+TEST_F(PileSegmenteeTest, copieEtAssignationSurPlusieursSegments) {
+	PetitePile source;
+	for (int i = 0; i < 30; ++i)
+		source.empiler(i);
+	PetitePile copie(source);
+	EXPECT_EQ(30, copie.taille());
+	for (int i = 0; i < 30; ++i)
+		EXPECT_EQ(source[i], copie[i]);
+
+	PetitePile cible;
+	for (int i = 0; i < 50; ++i)
+		cible.empiler(-i);
+	cible = source;
+	EXPECT_EQ(30, cible.taille());
+	EXPECT_EQ(29, cible.depiler());
+	EXPECT_EQ(29, source.top());
+
+	std::ostringstream sortie;
+	PetitePile courte;
+	for (int i = 1; i <= 6; ++i)
+		courte.empiler(i);
+	sortie << courte;
+	EXPECT_EQ("Pile: [6,5,4,3,2,1]", sortie.str());
+}
+
+TEST_F(PileSegmenteeTest, elementsDetruitsUneSeuleFois) {
+	std::shared_ptr<int> partage(new int(1));
+	{
+		PileSegmentee<std::shared_ptr<int>, 2, 3> pointeurs;
+		for (int i = 0; i < 10; ++i)
+			pointeurs.empiler(partage);
+		EXPECT_EQ(11, partage.use_count());
+		for (int i = 0; i < 6; ++i)
+			pointeurs.depiler();
+		EXPECT_EQ(5, partage.use_count());
+		PileSegmentee<std::shared_ptr<int>, 2, 3> copie(pointeurs);
+		EXPECT_EQ(9, partage.use_count());
+	}
+	EXPECT_EQ(1, partage.use_count());
+}
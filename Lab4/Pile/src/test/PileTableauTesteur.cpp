@@ -0,0 +1,174 @@
+/**
+ * \file PileTableauTesteur.cpp
+ * \brief Tests unitaires pour PileTableau
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PileTableau.
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PileTableau.h"
+#include "../main/Comparable.h"
+
+static const Comparable c1(1, "bleu");
+static const Comparable c2(2, "rouge");
+static const Comparable c3(3, "vert");
+static const Comparable c4(4, "jaune");
+
+using namespace lab04;
+
+struct PileTableauTest: public ::testing::Test {
+	virtual void SetUp() {
+		pile2.empiler(c1);
+		pile2.empiler(c2);
+		pile2.empiler(c3);
+		pile2.empiler(c4);
+	}
+	// virtual void TearDown() {}
+	PileTableau<Comparable> pile1;
+	PileTableau<Comparable> pile2;
+};
+
+TEST_F(PileTableauTest, ajoutUnElementOk) {
+	pile1.empiler(c4);
+	EXPECT_FALSE(pile1.estVide());
+	EXPECT_EQ(1, pile1.taille());
+}
+
+TEST_F(PileTableauTest, ajoutTroisElementOk) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	EXPECT_EQ(1, pile1.taille());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	EXPECT_EQ(2, pile1.taille());
+	pile1.empiler(c3);
+	EXPECT_EQ(c3, pile1.top());
+	EXPECT_EQ(3, pile1.taille());
+}
+
+TEST_F(PileTableauTest, ajoutUnElementEnleveUnElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileTableauTest, ajoutTroisElementEnleveTroisElements) {
+	pile1.empiler(c1);
+	EXPECT_EQ(c1, pile1.top());
+	pile1.empiler(c2);
+	EXPECT_EQ(c2, pile1.top());
+	pile1.empiler(c3);
+	EXPECT_EQ(3, pile1.taille());
+	EXPECT_EQ(c3, pile1.depiler());
+	EXPECT_EQ(2, pile1.taille());
+	EXPECT_EQ(c2, pile1.depiler());
+	EXPECT_EQ(1, pile1.taille());
+	EXPECT_EQ(c1, pile1.depiler());
+	EXPECT_TRUE(pile1.estVide());
+}
+
+TEST_F(PileTableauTest, TestCaseBracketOperator1elem) {
+	pile1.empiler(c1);
+	EXPECT_TRUE(c1 == pile1[0]);
+}
+
+TEST_F(PileTableauTest, TestCaseBracketOperator3elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	EXPECT_TRUE(c3 == pile1[0]);
+	EXPECT_TRUE(c2 == pile1[1]);
+	EXPECT_TRUE(c1 == pile1[2]);
+}
+
+TEST_F(PileTableauTest, TestCaseOperatorEqual1ElemEach) {
+	pile1.empiler(c1);
+	PileTableau<Comparable> autre;
+	autre.empiler(c1);
+	autre = pile1;
+	EXPECT_TRUE(c1 == pile1.top());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileTableauTest, TestCaseOperatorEqual3) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileTableau<Comparable> autre;
+	autre = pile1;
+	EXPECT_EQ(3, autre.taille());
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileTableauTest, TestCaseCopyConst1ElemEach) {
+	pile1.empiler(c1);
+	PileTableau<Comparable> autre(pile1);
+	EXPECT_EQ(1, autre.taille());
+	EXPECT_TRUE(c1 == autre.top());
+}
+
+TEST_F(PileTableauTest, TestCaseCopyConst3Elem) {
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	PileTableau<Comparable> autre(pile1);
+	EXPECT_TRUE(c3 == autre.top());
+	EXPECT_TRUE(c3 == autre[0]);
+	EXPECT_TRUE(c2 == autre[1]);
+	EXPECT_TRUE(c1 == autre[2]);
+}
+
+TEST_F(PileTableauTest, TestCaseOperatorOstream) {
+	std::ostringstream oss;
+
+	pile1.empiler(c1);
+	pile1.empiler(c2);
+	pile1.empiler(c3);
+	oss << pile1;
+
+	std::string expected =
+			"Pile: [Valeur->3     Mot->vert\n,Valeur->2     Mot->rouge\n,Valeur->1     Mot->bleu\n]";
+	EXPECT_EQ(expected, oss.str());
+}
+
+TEST_F(PileTableauTest, depilerPileVideLanceLogicError) {
+	PileTableau<int> pileVide;
+	EXPECT_THROW(pileVide.depiler(), PreconditionException);
+}
+
+TEST_F(PileTableauTest, topPileVideLanceLogicError) {
+	PileTableau<int> pileVide;
+	EXPECT_THROW(pileVide.top(), PreconditionException);
+}
+
+TEST_F(PileTableauTest, operatorCrochetErreur) {
+	PileTableau<int> unePile;
+	unePile.empiler(5);
+	EXPECT_THROW(unePile[-1], PreconditionException);
+	EXPECT_THROW(unePile[2], PreconditionException);
+}
+
+
+TEST_F(PileTableauTest, empilerAuDelaDeLaCapaciteOk) {
+	PileTableau<int> petite(2);
+	for (int i = 0; i < 100; ++i)
+		petite.empiler(i);
+	EXPECT_EQ(100, petite.taille());
+	EXPECT_EQ(99, petite.top());
+	EXPECT_EQ(0, petite[99]);
+	EXPECT_EQ(50, petite[49]);
+
+	PileTableau<int> copie(petite);
+	for (int i = 99; i >= 0; --i)
+		EXPECT_EQ(i, copie.depiler());
+	EXPECT_TRUE(copie.estVide());
+	EXPECT_EQ(100, petite.taille());
+}
+
+TEST_F(PileTableauTest, capaciteInvalideLanceLogicError) {
+	EXPECT_THROW(PileTableau<int> invalide(0), PreconditionException);
+}
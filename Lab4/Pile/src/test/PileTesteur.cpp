@@ -12,6 +12,9 @@
 #include "gtest/gtest.h"
 #include "../main/Pile.h"
 #include "../main/Comparable.h"
+#include <string>
+#include <utility>
+#include <vector>
 
 static const Comparable c1(1, "bleu");
 static const Comparable c2(2, "rouge");
@@ -155,3 +158,47 @@ TEST_F(PileTest, operatorCrochetErreur) {
 	EXPECT_THROW(unePile[2], PreconditionException);
 }
 
+
+TEST_F(PileTest, empilerParDeplacementGardeLeTampon) {
+	Pile<std::vector<int> > vecteurs;
+	std::vector<int> v(1000, 7);
+	const int * donnees = v.data();
+	vecteurs.empiler(std::move(v));
+	EXPECT_EQ(donnees, vecteurs.top().data());
+
+	std::vector<int> recu = vecteurs.depiler();
+	EXPECT_EQ(donnees, recu.data());
+	EXPECT_EQ(1000u, recu.size());
+}
+
+TEST_F(PileTest, emplaceConstruitSurPlace) {
+	Pile<std::vector<int> > vecteurs;
+	vecteurs.emplace(3, 9);
+	vecteurs.emplace();
+	EXPECT_EQ(2, vecteurs.taille());
+	EXPECT_TRUE(vecteurs.top().empty());
+	vecteurs.depiler();
+	EXPECT_EQ(std::vector<int>(3, 9), vecteurs.top());
+
+	Pile<Comparable> comparables;
+	comparables.emplace(5, "mauve");
+	EXPECT_EQ(Comparable(5, "mauve"), comparables.top());
+}
+
+TEST_F(PileTest, depilerDansUnObjetExistant) {
+	Pile<std::vector<int> > vecteurs;
+	vecteurs.emplace(500, 1);
+	const int * donnees = vecteurs.top().data();
+
+	std::vector<int> cible(10, 2);
+	vecteurs.depiler(cible);
+	EXPECT_EQ(donnees, cible.data());
+	EXPECT_EQ(500u, cible.size());
+	EXPECT_TRUE(vecteurs.estVide());
+
+	Comparable dernier;
+	pile2.depiler(dernier);
+	EXPECT_EQ(c4, dernier);
+	EXPECT_EQ(3, pile2.taille());
+	EXPECT_THROW(vecteurs.depiler(cible), PreconditionException);
+}
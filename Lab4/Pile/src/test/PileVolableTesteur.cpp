@@ -0,0 +1,155 @@
+/**
+ * \file PileVolableTesteur.cpp
+ * \brief Les tests unitaires de PileVolable.
+ * \version 0.1
+ *
+ * Implémentation des tests unitaires pour PileVolable
+ */
+
+#include "gtest/gtest.h"
+#include "../main/PileVolable.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace lab04;
+
+static const int NB_VOLEURS = 4;
+static const int NB_ELEMENTS = 200000;
+
+class PileVolableTest: public ::testing::Test
+{
+protected:
+	virtual void SetUp() {
+		pile.empiler(1);
+		pile.empiler(2);
+		pile.empiler(3);
+	}
+	PileVolable<int> pileVide;
+	PileVolable<int> pile;
+};
+
+TEST_F(PileVolableTest, constructeurVideOK)
+{
+	int el = 0;
+	EXPECT_TRUE(pileVide.estVide());
+	EXPECT_EQ(0, pileVide.taille());
+	EXPECT_FALSE(pileVide.depiler(el));
+	EXPECT_FALSE(pileVide.voler(el));
+}
+
+TEST_F(PileVolableTest, proprietaireDepileLePlusRecent)
+{
+	int el = 0;
+	EXPECT_EQ(3, pile.taille());
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(3, el);
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(2, el);
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(1, el);
+	EXPECT_FALSE(pile.depiler(el));
+	EXPECT_TRUE(pile.estVide());
+}
+
+TEST_F(PileVolableTest, voleurPrendLePlusAncien)
+{
+	int el = 0;
+	EXPECT_TRUE(pile.voler(el));
+	EXPECT_EQ(1, el);
+	EXPECT_TRUE(pile.depiler(el));
+	EXPECT_EQ(3, el);
+	EXPECT_TRUE(pile.voler(el));
+	EXPECT_EQ(2, el);
+	EXPECT_FALSE(pile.voler(el));
+	EXPECT_FALSE(pile.depiler(el));
+}
+
+TEST_F(PileVolableTest, agrandissementGardeLesElements)
+{
+	PileVolable<int> petite(2);
+	int el = 0;
+	for (int i = 0; i < 10; ++i)
+		petite.empiler(i);
+	EXPECT_TRUE(petite.voler(el));
+	EXPECT_EQ(0, el);
+	for (int i = 10; i < 1000; ++i)
+		petite.empiler(i);
+	EXPECT_EQ(999, petite.taille());
+	for (int i = 999; i >= 1; --i)
+	{
+		EXPECT_TRUE(petite.depiler(el));
+		EXPECT_EQ(i, el);
+	}
+	EXPECT_TRUE(petite.estVide());
+}
+
+TEST_F(PileVolableTest, capaciteInvalideLanceLogicError)
+{
+	EXPECT_THROW(PileVolable<int> invalide(0), PreconditionException);
+}
+
+TEST_F(PileVolableTest, volsConcurrentsChaqueElementUneSeuleFois)
+{
+	PileVolable<int> travail(4);
+	std::vector<std::atomic<int> > pris(NB_ELEMENTS);
+	for (int i = 0; i < NB_ELEMENTS; ++i)
+		pris[i].store(0);
+	std::atomic<bool> fini(false);
+
+	std::vector<std::thread> voleurs;
+	for (int v = 0; v < NB_VOLEURS; ++v)
+	{
+		voleurs.push_back(std::thread([&travail, &pris, &fini]() {
+			int el;
+			while (!fini.load())
+			{
+				if (travail.voler(el))
+					pris[el].fetch_add(1);
+			}
+		}));
+	}
+
+	int el;
+	for (int i = 0; i < NB_ELEMENTS; ++i)
+	{
+		travail.empiler(i);
+		if (i % 3 == 0 && travail.depiler(el))
+			pris[el].fetch_add(1);
+	}
+	while (travail.depiler(el))
+		pris[el].fetch_add(1);
+	fini.store(true);
+	for (std::size_t v = 0; v < voleurs.size(); ++v)
+		voleurs[v].join();
+
+	for (int i = 0; i < NB_ELEMENTS; ++i)
+		EXPECT_EQ(1, pris[i].load()) << "élément " << i;
+}
+
+TEST_F(PileVolableTest, depilerPerduNeModifiePasLElement)
+{
+	PileVolable<int> travail(4);
+	std::atomic<bool> fini(false);
+	std::thread voleur([&travail, &fini]() {
+		int el;
+		while (!fini.load())
+			travail.voler(el);
+	});
+
+	for (int i = 0; i < NB_ELEMENTS; ++i)
+	{
+		int el = -1;
+		travail.empiler(i);
+		if (travail.depiler(el))
+		{
+			EXPECT_EQ(i, el);
+		}
+		else
+		{
+			EXPECT_EQ(-1, el);
+		}
+	}
+	fini.store(true);
+	voleur.join();
+}